@@ -8,6 +8,7 @@
 #include "refs/localization_ref.h"
 
 #include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/hashing_context.hpp>
 #include <godot_cpp/variant/utility_functions.hpp>
 
 namespace godot {
@@ -38,6 +39,9 @@ void GameScriptDatabase::_bind_methods() {
     ClassDB::bind_method(D_METHOD("get_localization", "index"), &GameScriptDatabase::get_localization);
     ClassDB::bind_method(D_METHOD("find_localization", "id"), &GameScriptDatabase::find_localization);
 
+    ClassDB::bind_method(D_METHOD("query_conversations_by_tags", "tags"), &GameScriptDatabase::query_conversations_by_tags);
+    ClassDB::bind_method(D_METHOD("query_localizations_by_tags", "tags"), &GameScriptDatabase::query_localizations_by_tags);
+
     ADD_PROPERTY(PropertyInfo(Variant::INT, "conversation_count"), "", "get_conversation_count");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "node_count"), "", "get_node_count");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "actor_count"), "", "get_actor_count");
@@ -85,14 +89,40 @@ bool GameScriptDatabase::load_snapshot(int locale_index) {
         return false;
     }
 
+    // Trusted builds hash each chunk as it is read; a match with the manifest
+    // stands in for structural verification
+    String expected_hash = _manifest->get_locale_hash(locale_index);
+    Ref<HashingContext> hasher;
+    if (_manifest->get_trust_manifest_hash() && !expected_hash.is_empty()) {
+        hasher.instantiate();
+        hasher->start(HashingContext::HASH_SHA256);
+    }
+
+    static constexpr int64_t READ_CHUNK_SIZE = 1024 * 1024;
     int64_t file_length = file->get_length();
     _snapshot_buffer.resize(file_length);
-    file->get_buffer(_snapshot_buffer.ptrw(), file_length);
+    for (int64_t offset = 0; offset < file_length;) {
+        int64_t count = MIN(file_length - offset, READ_CHUNK_SIZE);
+        file->get_buffer(_snapshot_buffer.ptrw() + offset, count);
+        if (hasher.is_valid()) {
+            hasher->update(_snapshot_buffer.slice(offset, offset + count));
+        }
+        offset += count;
+    }
     file->close();
 
+    bool trusted = false;
+    if (hasher.is_valid()) {
+        trusted = hasher->finish().hex_encode() == expected_hash.to_lower() &&
+            _snapshot_buffer.size() > 8 && GameScript::SnapshotBufferHasIdentifier(_snapshot_buffer.ptr());
+        if (!trusted) {
+            UtilityFunctions::push_warning("GameScriptDatabase: Snapshot does not match manifest hash, verifying: ", snapshot_path);
+        }
+    }
+
     // Verify FlatBuffers data
     flatbuffers::Verifier verifier(_snapshot_buffer.ptr(), _snapshot_buffer.size());
-    if (!GameScript::VerifySnapshotBuffer(verifier)) {
+    if (!trusted && !GameScript::VerifySnapshotBuffer(verifier)) {
         UtilityFunctions::push_error("GameScriptDatabase: Invalid snapshot data in file: ", snapshot_path);
         _snapshot_buffer.clear();
         return false;
@@ -100,10 +130,51 @@ bool GameScriptDatabase::load_snapshot(int locale_index) {
 
     _snapshot = GameScript::GetSnapshot(_snapshot_buffer.ptr());
     _current_locale_index = locale_index;
+    build_tag_indices();
 
     return true;
 }
 
+template <typename TEntities>
+static void build_tag_index(const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* names,
+    const flatbuffers::Vector<flatbuffers::Offset<GameScript::StringArray>>* values,
+    const TEntities* entities, TagIndex& out_index) {
+    out_index.clear();
+
+    // Tag categories, then each entity's value per category (-1 = untagged)
+    int category_count = names && values ? MIN(names->size(), values->size()) : 0;
+    LocalVector<String> value_names;
+    for (int c = 0; c < category_count; c++) {
+        value_names.clear();
+        if (const auto* category_values = values->Get(c)->values()) {
+            for (const flatbuffers::String* value : *category_values) {
+                value_names.push_back(String::utf8(value->c_str()));
+            }
+        }
+        out_index.add_category(String::utf8(names->Get(c)->c_str()), value_names);
+    }
+
+    int entity_count = entities ? entities->size() : 0;
+    for (int i = 0; i < entity_count && category_count > 0; i++) {
+        const auto* tag_indices = entities->Get(i)->tag_indices();
+        int count = tag_indices ? MIN(static_cast<int>(tag_indices->size()), category_count) : 0;
+        for (int c = 0; c < count; c++) {
+            int value = tag_indices->Get(c);
+            if (value >= 0) {
+                out_index.add(c, value, i);
+            }
+        }
+    }
+    out_index.finalize(entity_count);
+}
+
+void GameScriptDatabase::build_tag_indices() {
+    build_tag_index(_snapshot->conversation_tag_names(), _snapshot->conversation_tag_values(),
+        _snapshot->conversations(), _conversation_tags);
+    build_tag_index(_snapshot->localization_tag_names(), _snapshot->localization_tag_values(),
+        _snapshot->localizations(), _localization_tags);
+}
+
 Ref<LocaleRef> GameScriptDatabase::get_current_locale() {
     if (!_manifest.is_valid() || _current_locale_index < 0) {
         return Ref<LocaleRef>();
@@ -313,4 +384,13 @@ Ref<LocalizationRef> GameScriptDatabase::find_localization(int id) {
     return Ref<LocalizationRef>();
 }
 
+// Tag queries
+PackedInt32Array GameScriptDatabase::query_conversations_by_tags(const Dictionary& tags) const {
+    return _conversation_tags.query(tags);
+}
+
+PackedInt32Array GameScriptDatabase::query_localizations_by_tags(const Dictionary& tags) const {
+    return _localization_tags.query(tags);
+}
+
 } // namespace godot
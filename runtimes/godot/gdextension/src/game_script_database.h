@@ -6,6 +6,7 @@
 #include <godot_cpp/variant/packed_byte_array.hpp>
 
 #include "generated/snapshot_generated.h"
+#include "tag_index.h"
 
 namespace godot {
 
@@ -33,6 +34,8 @@ class GameScriptDatabase : public RefCounted {
     int _current_locale_index;
     PackedByteArray _snapshot_buffer;
     const GameScript::Snapshot* _snapshot;
+    TagIndex _conversation_tags;
+    TagIndex _localization_tags;
 
 protected:
     static void _bind_methods();
@@ -77,11 +80,17 @@ public:
     Ref<LocalizationRef> get_localization(int index);
     Ref<LocalizationRef> find_localization(int id);
 
+    // Tag queries: { category: value } or { category: [values] } -> ascending indices
+    // (categories AND, listed values OR; an empty dictionary matches everything)
+    PackedInt32Array query_conversations_by_tags(const Dictionary& tags) const;
+    PackedInt32Array query_localizations_by_tags(const Dictionary& tags) const;
+
     // Internal accessor for Ref classes
     const GameScript::Snapshot* get_snapshot() const { return _snapshot; }
 
 private:
     bool load_snapshot(int locale_index);
+    void build_tag_indices();
 };
 
 } // namespace godot
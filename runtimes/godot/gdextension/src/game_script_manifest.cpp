@@ -22,13 +22,16 @@ void GameScriptManifest::_bind_methods() {
     ClassDB::bind_method(D_METHOD("has_locale_by_name", "name"), &GameScriptManifest::has_locale_by_name);
     ClassDB::bind_method(D_METHOD("load_database", "locale"), &GameScriptManifest::load_database);
     ClassDB::bind_method(D_METHOD("load_database_primary"), &GameScriptManifest::load_database_primary);
+    ClassDB::bind_method(D_METHOD("set_trust_manifest_hash", "trust"), &GameScriptManifest::set_trust_manifest_hash);
+    ClassDB::bind_method(D_METHOD("get_trust_manifest_hash"), &GameScriptManifest::get_trust_manifest_hash);
 
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "version"), "", "get_version");
     ADD_PROPERTY(PropertyInfo(Variant::STRING, "exported_at"), "", "get_exported_at");
     ADD_PROPERTY(PropertyInfo(Variant::INT, "locale_count"), "", "get_locale_count");
+    ADD_PROPERTY(PropertyInfo(Variant::BOOL, "trust_manifest_hash"), "set_trust_manifest_hash", "get_trust_manifest_hash");
 }
 
-GameScriptManifest::GameScriptManifest() : _primary_locale_index(0) {
+GameScriptManifest::GameScriptManifest() : _primary_locale_index(0), _trust_manifest_hash(false) {
 }
 
 GameScriptManifest::~GameScriptManifest() {
@@ -199,6 +202,14 @@ String GameScriptManifest::get_locale_hash(int index) const {
     return _locales[index].hash;
 }
 
+void GameScriptManifest::set_trust_manifest_hash(bool trust) {
+    _trust_manifest_hash = trust;
+}
+
+bool GameScriptManifest::get_trust_manifest_hash() const {
+    return _trust_manifest_hash;
+}
+
 String GameScriptManifest::get_snapshot_path(int locale_index) const {
     if (locale_index < 0 || locale_index >= _locales.size()) {
         return String();
@@ -29,6 +29,7 @@ class GameScriptManifest : public RefCounted {
     String _base_path;
     Vector<ManifestLocale> _locales;
     int _primary_locale_index;
+    bool _trust_manifest_hash;
 
 protected:
     static void _bind_methods();
@@ -57,6 +58,10 @@ public:
     bool has_locale(int id) const;
     bool has_locale_by_name(const String& name) const;
 
+    // Trusted builds only: skip snapshot verification when the file's SHA-256 matches the manifest
+    void set_trust_manifest_hash(bool trust);
+    bool get_trust_manifest_hash() const;
+
     // Database creation
     Ref<GameScriptDatabase> load_database(Ref<LocaleRef> locale);
     Ref<GameScriptDatabase> load_database_primary();
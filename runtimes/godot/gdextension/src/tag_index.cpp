@@ -0,0 +1,165 @@
+#include "tag_index.h"
+
+#include <godot_cpp/variant/array.hpp>
+
+#include <cstring>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace godot {
+
+static inline int count_trailing_zeros(uint64_t word) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+int TagIndex::add_category(const String& name, const LocalVector<String>& values) {
+    int category_index = _categories.size();
+    _categories.push_back(Category());
+    Category& category = _categories[category_index];
+    category.values.resize(values.size());
+    for (uint32_t i = 0; i < values.size(); i++) {
+        // First wins on duplicate names
+        if (!category.value_to_index.has(values[i])) {
+            category.value_to_index.insert(values[i], i);
+        }
+    }
+    if (!_category_to_index.has(name)) {
+        _category_to_index.insert(name, category_index);
+    }
+    return category_index;
+}
+
+void TagIndex::add(int category, int value, int entity_index) {
+    if (category < 0 || category >= static_cast<int>(_categories.size())) return;
+    LocalVector<Container>& values = _categories[category].values;
+    if (value < 0 || value >= static_cast<int>(values.size())) return;
+
+    // Entities are added in index order, so the array stays sorted
+    values[value].indices.push_back(entity_index);
+}
+
+void TagIndex::finalize(int entity_count) {
+    _entity_count = entity_count;
+    _word_count = (entity_count + 63) / 64;
+
+    for (Category& category : _categories) {
+        for (Container& container : category.values) {
+            container.count = container.indices.size();
+
+            // Dense once the bitmap is smaller than the array (4 bytes per entry vs. 1 bit per entity)
+            if (static_cast<int64_t>(container.count) * 32 > static_cast<int64_t>(_word_count) * 64) {
+                container.words.resize(_word_count);
+                memset(container.words.ptr(), 0, _word_count * sizeof(uint64_t));
+                for (int32_t entity_index : container.indices) {
+                    container.words[entity_index >> 6] |= uint64_t(1) << (entity_index & 63);
+                }
+                container.indices.reset();
+            }
+        }
+    }
+}
+
+void TagIndex::clear() {
+    _categories.reset();
+    _category_to_index.clear();
+    _entity_count = 0;
+    _word_count = 0;
+}
+
+const TagIndex::Container* TagIndex::find_container(const Category& category, const String& value) const {
+    const int* value_index = category.value_to_index.getptr(value);
+    return value_index ? &category.values[*value_index] : nullptr;
+}
+
+void TagIndex::or_into(LocalVector<uint64_t>& words, const Container& container) const {
+    if (container.words.size() > 0) {
+        uint64_t* dest = words.ptr();
+        const uint64_t* source = container.words.ptr();
+        for (int i = 0; i < _word_count; i++) {
+            dest[i] |= source[i];
+        }
+        return;
+    }
+
+    for (int32_t entity_index : container.indices) {
+        words[entity_index >> 6] |= uint64_t(1) << (entity_index & 63);
+    }
+}
+
+PackedInt32Array TagIndex::query(const Dictionary& tags) const {
+    PackedInt32Array result;
+
+    if (tags.is_empty()) {
+        result.resize(_entity_count);
+        for (int i = 0; i < _entity_count; i++) {
+            result.set(i, i);
+        }
+        return result;
+    }
+
+    LocalVector<uint64_t> matched;
+    LocalVector<uint64_t> term;
+    Array categories = tags.keys();
+    for (int t = 0; t < categories.size(); t++) {
+        const int* category_index = _category_to_index.getptr(String(categories[t]));
+        if (!category_index) {
+            return result;
+        }
+        const Category& category = _categories[*category_index];
+
+        // First term ORs straight into the result
+        LocalVector<uint64_t>& target = t == 0 ? matched : term;
+        target.resize(_word_count);
+        memset(target.ptr(), 0, _word_count * sizeof(uint64_t));
+
+        Variant values = tags[categories[t]];
+        Array value_list;
+        if (values.get_type() == Variant::ARRAY) {
+            value_list = values;
+        } else {
+            value_list.push_back(values);
+        }
+
+        bool any_value = false;
+        for (int v = 0; v < value_list.size(); v++) {
+            if (const Container* container = find_container(category, String(value_list[v]))) {
+                or_into(target, *container);
+                any_value = true;
+            }
+        }
+        if (!any_value) {
+            return result;
+        }
+
+        if (t > 0) {
+            uint64_t* dest = matched.ptr();
+            const uint64_t* source = term.ptr();
+            for (int i = 0; i < _word_count; i++) {
+                dest[i] &= source[i];
+            }
+        }
+    }
+
+    for (int w = 0; w < _word_count; w++) {
+        for (uint64_t word = matched[w]; word != 0; word &= word - 1) {
+            result.push_back((w << 6) + count_trailing_zeros(word));
+        }
+    }
+    return result;
+}
+
+int TagIndex::count_tagged(const String& category, const String& value) const {
+    const int* category_index = _category_to_index.getptr(category);
+    const Container* container = category_index ? find_container(_categories[*category_index], value) : nullptr;
+    return container ? container->count : 0;
+}
+
+} // namespace godot
@@ -0,0 +1,57 @@
+#ifndef GAMESCRIPT_TAG_INDEX_H
+#define GAMESCRIPT_TAG_INDEX_H
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/packed_int32_array.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <cstdint>
+
+namespace godot {
+
+// Per-tag-value bitmaps over one entity table (conversations or localizations), built at load.
+//
+// Each tag value keeps its entities in a roaring-style container: a sorted index array while
+// sparse, a dense 64-bit word bitmap once that is smaller. A query ORs a term's values into a
+// scratch bitmap and ANDs the terms word by word, then extracts the set bits.
+class TagIndex {
+public:
+    // Building - add categories in snapshot order, tag entities in index order, then finalize
+    int add_category(const String& name, const LocalVector<String>& values);
+    void add(int category, int value, int entity_index);
+    void finalize(int entity_count);
+    void clear();
+
+    // Query: { category: value } or { category: [values] } - categories AND, listed values OR.
+    // Names match case-sensitively, as exported. Unknown categories or values match nothing;
+    // an empty query matches everything.
+    PackedInt32Array query(const Dictionary& tags) const;
+
+    int count_tagged(const String& category, const String& value) const;
+
+private:
+    struct Container {
+        LocalVector<int32_t> indices;   // Sparse: ascending entity indices
+        LocalVector<uint64_t> words;    // Dense: one bit per entity (indices emptied)
+        int count = 0;
+    };
+
+    struct Category {
+        HashMap<String, int> value_to_index;
+        LocalVector<Container> values;
+    };
+
+    LocalVector<Category> _categories;
+    HashMap<String, int> _category_to_index;
+    int _entity_count = 0;
+    int _word_count = 0;
+
+    const Container* find_container(const Category& category, const String& value) const;
+    void or_into(LocalVector<uint64_t>& words, const Container& container) const;
+};
+
+} // namespace godot
+
+#endif // GAMESCRIPT_TAG_INDEX_H
@@ -76,6 +76,7 @@ class _GameScriptIdPropertyEditor extends EditorProperty:
 	func _ready() -> void:
 		_build_ui()
 		_update_display()
+		_GameScriptEditorDatabase.connect_reloaded(_update_display)
 
 
 	func _build_ui() -> void:
@@ -183,6 +184,7 @@ class _GameScriptIdPropertyEditor extends EditorProperty:
 
 
 	func _exit_tree() -> void:
+		_GameScriptEditorDatabase.disconnect_reloaded(_update_display)
 		if _picker_dialog:
 			_picker_dialog.queue_free()
 			_picker_dialog = null
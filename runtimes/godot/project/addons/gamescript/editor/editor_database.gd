@@ -4,7 +4,8 @@ extends RefCounted
 ## Editor-only singleton for accessing GameScript data in property drawers and pickers.
 ##
 ## This class provides lazy-loaded, cached access to the manifest and database
-## for use in the Godot editor. It handles hot-reloading when the snapshot changes.
+## for use in the Godot editor. It hot-reloads when the plugin reports a filesystem
+## change (request_reload), not on access.
 ##
 ## NOTE: This class is prefixed with underscore to indicate internal use.
 ## Users should not interact with this class directly.
@@ -16,11 +17,20 @@ static var _settings_path: String
 # Cached data
 var _manifest: GameScriptManifest
 var _database: GameScriptDatabase
-var _last_check_time: int = 0
 var _current_locale_hash: String = ""
 
-# How often to check for hot-reload (in milliseconds)
-const HOT_RELOAD_CHECK_INTERVAL_MS := 1000
+# Hot-reload state: bursts of change notifications collapse into one background reload
+const RELOAD_DEBOUNCE_SEC := 0.5
+static var _reload_generation: int = 0
+static var _reload_task_id: int = -1
+static var _reload_pending: bool = false
+
+
+# Emits reloaded on the main thread after hot-reload swapped in new data
+class _ReloadNotifier:
+	signal reloaded
+
+static var _notifier := _ReloadNotifier.new()
 
 
 ## Get the shared editor database instance.
@@ -52,6 +62,34 @@ static func get_manifest() -> GameScriptManifest:
 static func clear() -> void:
 	_instance = null
 	_settings_path = ""
+	_reload_generation += 1
+
+
+## Call after hot-reload swaps in new data (inspectors refresh their labels).
+static func connect_reloaded(callable: Callable) -> void:
+	if not _notifier.reloaded.is_connected(callable):
+		_notifier.reloaded.connect(callable)
+
+
+static func disconnect_reloaded(callable: Callable) -> void:
+	if _notifier.reloaded.is_connected(callable):
+		_notifier.reloaded.disconnect(callable)
+
+
+## Request a hot-reload check (connected to EditorFileSystem.filesystem_changed).
+## Requests within RELOAD_DEBOUNCE_SEC are coalesced. The manifest hash is compared and the
+## snapshot loaded on a worker thread; the data is swapped on the main thread, then
+## reloaded listeners run once.
+static func request_reload() -> void:
+	_reload_generation += 1
+	var generation := _reload_generation
+	var tree := Engine.get_main_loop() as SceneTree
+	if not tree:
+		return
+	tree.create_timer(RELOAD_DEBOUNCE_SEC).timeout.connect(func():
+		if generation == _reload_generation:
+			_start_reload()
+	)
 
 
 ## Get the display name for a conversation by ID.
@@ -179,15 +217,6 @@ static func _ensure_instance() -> void:
 	if not _instance._manifest:
 		_instance._load_data(settings)
 
-	# Check for hot-reload (only when not playing)
-	if not Engine.is_editor_hint() or EditorInterface.is_playing_scene():
-		return
-
-	var current_time := Time.get_ticks_msec()
-	if current_time - _instance._last_check_time > HOT_RELOAD_CHECK_INTERVAL_MS:
-		_instance._last_check_time = current_time
-		_instance._check_hot_reload(settings)
-
 
 # Internal: Find GameScriptSettings resource
 static func _find_settings() -> GameScriptSettings:
@@ -232,12 +261,7 @@ func _load_data(settings: GameScriptSettings) -> void:
 		return
 
 	# Load editor locale snapshot (falls back to primary from manifest)
-	var editor_locale: LocaleRef = null
-	if settings.editor_locale_index >= 0 and settings.editor_locale_index < _manifest.get_locale_count():
-		editor_locale = _manifest.get_locale(settings.editor_locale_index)
-	else:
-		editor_locale = _manifest.get_primary_locale()
-
+	var editor_locale := _get_editor_locale(_manifest, settings.editor_locale_index)
 	if editor_locale and editor_locale.is_valid():
 		_database = _manifest.load_database(editor_locale)
 	else:
@@ -250,30 +274,70 @@ func _load_data(settings: GameScriptSettings) -> void:
 		_current_locale_hash = ""
 
 
-# Check if snapshot has changed and reload if needed
-func _check_hot_reload(settings: GameScriptSettings) -> void:
-	# If we don't have data loaded, try to load it
-	if not _manifest or not _database:
-		_load_data(settings)
-		return
+# Editor locale from settings, falling back to the manifest's primary locale
+static func _get_editor_locale(manifest: GameScriptManifest, locale_index: int) -> LocaleRef:
+	if locale_index >= 0 and locale_index < manifest.get_locale_count():
+		return manifest.get_locale(locale_index)
+	return manifest.get_primary_locale()
 
-	# Reload the manifest to get the latest hash (manifest.json is small)
-	var manifest_path := "res://%s/manifest.json" % settings.game_data_path
-	if not FileAccess.file_exists(manifest_path):
-		return
 
-	var fresh_manifest := GameScriptManifest.load_from_path(manifest_path)
-	if not fresh_manifest:
+# Start the background reload (one at a time; a request arriving meanwhile runs after it)
+static func _start_reload() -> void:
+	# Nothing loaded yet: the next access loads fresh data anyway
+	if not _instance:
+		return
+	if _reload_task_id >= 0:
+		_reload_pending = true
 		return
 
-	# Compare the primary locale's hash to detect changes
-	var primary_locale := fresh_manifest.get_primary_locale()
-	if not primary_locale or not primary_locale.is_valid():
+	var settings := _find_settings()
+	if not settings:
 		return
 
-	var new_hash: String = primary_locale.get_hash()
-	if new_hash != _current_locale_hash:
-		# Hash changed - snapshot was re-exported, reload everything
-		_manifest = fresh_manifest
-		_database = _manifest.load_database_primary()
-		_current_locale_hash = new_hash
+	var data_path := settings.game_data_path
+	var locale_index := settings.editor_locale_index
+	var loaded_hash := _instance._current_locale_hash
+	_reload_task_id = WorkerThreadPool.add_task(func():
+		_reload_task(data_path, locale_index, loaded_hash)
+	, false, "GameScript editor reload")
+
+
+# Worker thread: reload the manifest (small) and, if the editor locale's hash changed, the snapshot
+static func _reload_task(data_path: String, locale_index: int, loaded_hash: String) -> void:
+	var manifest: GameScriptManifest = null
+	var database: GameScriptDatabase = null
+	var locale_hash := ""
+
+	var manifest_path := "res://%s/manifest.json" % data_path
+	if FileAccess.file_exists(manifest_path):
+		manifest = GameScriptManifest.load_from_path(manifest_path)
+	if manifest:
+		var editor_locale := _get_editor_locale(manifest, locale_index)
+		if editor_locale and editor_locale.is_valid():
+			locale_hash = editor_locale.get_hash()
+			if locale_hash == loaded_hash and not locale_hash.is_empty():
+				# Unchanged export (filesystem_changed fires for any project file)
+				(func(): _finish_reload(false, null, null, "", data_path)).call_deferred()
+				return
+			database = manifest.load_database(editor_locale)
+		else:
+			database = manifest.load_database_primary()
+
+	(func(): _finish_reload(true, manifest, database, locale_hash, data_path)).call_deferred()
+
+
+# Main thread: swap in the reloaded data and notify
+static func _finish_reload(changed: bool, manifest: GameScriptManifest, database: GameScriptDatabase, locale_hash: String, data_path: String) -> void:
+	WorkerThreadPool.wait_for_task_completion(_reload_task_id)
+	_reload_task_id = -1
+
+	# Drop results for a different data path (settings changed meanwhile) or a cleared instance
+	if changed and _instance and _settings_path == data_path:
+		_instance._manifest = manifest
+		_instance._database = database
+		_instance._current_locale_hash = locale_hash
+		_notifier.reloaded.emit()
+
+	if _reload_pending:
+		_reload_pending = false
+		_start_reload()
@@ -29,8 +29,15 @@ func _enter_tree() -> void:
 	_export_validator = preload("res://addons/gamescript/editor/export_validator.gd").new()
 	add_export_plugin(_export_validator)
 
+	# Hot-reload editor data when the filesystem scan sees changes (re-exports)
+	EditorInterface.get_resource_filesystem().filesystem_changed.connect(_on_filesystem_changed)
+
 
 func _exit_tree() -> void:
+	var filesystem := EditorInterface.get_resource_filesystem()
+	if filesystem.filesystem_changed.is_connected(_on_filesystem_changed):
+		filesystem.filesystem_changed.disconnect(_on_filesystem_changed)
+
 	# Unregister custom inspector plugins
 	if _conversation_inspector:
 		remove_inspector_plugin(_conversation_inspector)
@@ -51,3 +58,7 @@ func _exit_tree() -> void:
 
 	# Clear editor database cache
 	_GameScriptEditorDatabase.clear()
+
+
+func _on_filesystem_changed() -> void:
+	_GameScriptEditorDatabase.request_reload()
@@ -21,7 +21,10 @@ static func load_manifest() -> GameScriptManifest:
 ## Load a manifest using paths from a GameScriptSettings resource.
 static func load_manifest_from_settings(settings: GameScriptSettings) -> GameScriptManifest:
 	var path := "res://%s/manifest.json" % settings.game_data_path
-	return load_manifest_from_path(path)
+	var manifest := load_manifest_from_path(path)
+	if manifest:
+		manifest.trust_manifest_hash = settings.trust_manifest_hash
+	return manifest
 
 
 ## Load a manifest from a specific file path.
@@ -21,6 +21,11 @@ extends Resource
 ## instead of showing a decision prompt.
 @export var prevent_single_node_choices: bool = false
 
+## Trusted builds only: skip snapshot verification when the SHA-256 computed while
+## reading a snapshot matches manifest.json. Mismatches are still fully verified.
+## Leave disabled where snapshots can be replaced outside the shipped manifest (e.g., mods).
+@export var trust_manifest_hash: bool = false
+
 ## Which locale to use for editor pickers and property drawers.
 ## -1 = use primary locale from manifest (default).
 @export var editor_locale_index: int = -1
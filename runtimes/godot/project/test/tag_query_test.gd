@@ -0,0 +1,49 @@
+extends SceneTree
+## Headless check that tag queries match category and value names case-sensitively.
+##
+## Run from the project directory:
+##   godot --headless --script res://test/tag_query_test.gd
+##
+## The fixture in res://test/tag_fixture has conversation tag categories "Region"
+## (values "Docks", "docks", "Market") and "Type" (value "Bark"):
+##   index 0: Region=Docks,  Type=Bark
+##   index 1: Region=docks
+##   index 2: Region=Market, Type=Bark
+##   index 3: untagged
+
+const FIXTURE_MANIFEST := "res://test/tag_fixture/manifest.json"
+
+var _failures := 0
+
+
+func _init() -> void:
+	var manifest := GameScriptManifest.load_from_path(FIXTURE_MANIFEST)
+	if not manifest:
+		push_error("Failed to load tag fixture manifest")
+		quit(1)
+		return
+
+	var database := manifest.load_database_primary()
+	if not database:
+		push_error("Failed to load tag fixture database")
+		quit(1)
+		return
+
+	_expect(database, {"Region": "Docks"}, [0], "exact value")
+	_expect(database, {"Region": "docks"}, [1], "values differing only in case are distinct")
+	_expect(database, {"Region": "DOCKS"}, [], "value in another case")
+	_expect(database, {"region": "Docks"}, [], "category in another case")
+	_expect(database, {"Region": ["Docks", "docks"]}, [0, 1], "both cases listed")
+	_expect(database, {"Region": "Market", "Type": "Bark"}, [2], "categories AND")
+	_expect(database, {}, [0, 1, 2, 3], "empty query")
+
+	if _failures == 0:
+		print("[TagQueryTest] All checks passed")
+	quit(1 if _failures > 0 else 0)
+
+
+func _expect(database: GameScriptDatabase, tags: Dictionary, expected: Array, label: String) -> void:
+	var actual := Array(database.query_conversations_by_tags(tags))
+	if actual != expected:
+		_failures += 1
+		push_error("[TagQueryTest] %s: %s returned %s, expected %s" % [label, tags, actual, expected])
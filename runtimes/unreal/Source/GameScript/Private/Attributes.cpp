@@ -4,9 +4,11 @@
 TArray<FNodeConditionRegistration*> GConditionRegistrations;
 TArray<FNodeActionRegistration*> GActionRegistrations;
 
-FNodeConditionRegistration::FNodeConditionRegistration(int32 InNodeId, ConditionDelegate InFunction)
+FNodeConditionRegistration::FNodeConditionRegistration(int32 InNodeId, ConditionDelegate InFunction, bool bInVolatile, bool bInThreadSafe)
 	: NodeId(InNodeId)
 	, Function(InFunction)
+	, bVolatile(bInVolatile)
+	, bThreadSafe(bInThreadSafe)
 {
 	// Register at static initialization time
 	GConditionRegistrations.Add(this);
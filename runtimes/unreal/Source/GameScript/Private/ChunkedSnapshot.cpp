@@ -0,0 +1,186 @@
+#include "ChunkedSnapshot.h"
+
+#if WITH_EDITOR
+
+#include "SnapshotWriter.h"
+#include "CompressedSnapshot.h"
+#include "Serialization/MemoryWriter.h"
+#include "Generated/snapshot_generated.h"
+
+namespace GameScriptChunked
+{
+	// Ownership markers for the packing pass
+	static constexpr int32 Unreferenced = -2;
+	static constexpr int32 Shared = -1;
+
+	static void PadTo(FArchive& Ar, uint32 InAlignment)
+	{
+		uint8 Zero = 0;
+		while (Ar.Tell() % InAlignment != 0)
+		{
+			Ar << Zero;
+		}
+	}
+
+	// Wrap a region in a compressed container when a codec is requested
+	static bool CompressRegion(TArray<uint8>& Region, FName CompressionFormat)
+	{
+		if (CompressionFormat.IsNone())
+		{
+			return true;
+		}
+
+		TArray<uint8> Compressed;
+		if (!GameScriptCompressed::Compress(Region, Compressed, CompressionFormat))
+		{
+			return false;
+		}
+		Region = MoveTemp(Compressed);
+		return true;
+	}
+
+	bool Pack(const TArray<uint8>& SnapshotData, TArray<uint8>& OutData, int32& OutBlockCount, FName CompressionFormat)
+	{
+		flatbuffers::Verifier Verifier(SnapshotData.GetData(), SnapshotData.Num());
+		if (!GameScript::VerifySnapshotBuffer(Verifier))
+		{
+			return false;
+		}
+
+		const GameScript::Snapshot* Source = GameScript::GetSnapshot(SnapshotData.GetData());
+		const int32 LocalizationCount = Source->localizations() ? Source->localizations()->size() : 0;
+		const int32 ConversationCount = Source->conversations() ? Source->conversations()->size() : 0;
+
+		// 1. Find the single owning conversation of each localization (via node voice/UI text)
+		TArray<int32> Owners;
+		Owners.Init(Unreferenced, LocalizationCount);
+		for (int32 ConvIdx = 0; ConvIdx < ConversationCount; ++ConvIdx)
+		{
+			const auto* NodeIndices = Source->conversations()->Get(ConvIdx)->node_indices();
+			if (!NodeIndices)
+			{
+				continue;
+			}
+
+			for (int32 NodeIdx : *NodeIndices)
+			{
+				const GameScript::Node* Node = Source->nodes()->Get(NodeIdx);
+				for (int32 LocIdx : { Node->voice_text_idx(), Node->ui_response_text_idx() })
+				{
+					if (LocIdx < 0 || LocIdx >= LocalizationCount)
+					{
+						continue;
+					}
+					int32& Owner = Owners[LocIdx];
+					Owner = (Owner == Unreferenced || Owner == ConvIdx) ? ConvIdx : Shared;
+				}
+			}
+		}
+
+		// Actor names are needed outside any single conversation
+		if (const auto* Actors = Source->actors())
+		{
+			for (const GameScript::Actor* Actor : *Actors)
+			{
+				const int32 LocIdx = Actor->localized_name_idx();
+				if (LocIdx >= 0 && LocIdx < LocalizationCount)
+				{
+					Owners[LocIdx] = Shared;
+				}
+			}
+		}
+
+		// 2. Group owned localizations into one block per conversation
+		TArray<TArray<int32>> ConversationLocalizations;
+		ConversationLocalizations.SetNum(ConversationCount);
+		for (int32 LocIdx = 0; LocIdx < LocalizationCount; ++LocIdx)
+		{
+			if (Owners[LocIdx] >= 0)
+			{
+				ConversationLocalizations[Owners[LocIdx]].Add(LocIdx);
+			}
+		}
+
+		TArray<FGSChunkedBlockEntry> Entries;
+		TArray<TArray<uint8>> Blocks;
+		TArray<int32> LocalizationBlocks;
+		LocalizationBlocks.Init(-1, LocalizationCount);
+		for (int32 ConvIdx = 0; ConvIdx < ConversationCount; ++ConvIdx)
+		{
+			if (ConversationLocalizations[ConvIdx].Num() == 0)
+			{
+				continue;
+			}
+
+			const int32 BlockIdx = Blocks.Num();
+			for (int32 LocIdx : ConversationLocalizations[ConvIdx])
+			{
+				LocalizationBlocks[LocIdx] = BlockIdx;
+			}
+
+			FSnapshotWriter::WriteTextBlock(Source, ConversationLocalizations[ConvIdx], Blocks.AddDefaulted_GetRef());
+			FGSChunkedBlockEntry& Entry = Entries.AddDefaulted_GetRef();
+			Entry.ConversationId = Source->conversations()->Get(ConvIdx)->id();
+		}
+
+		// 3. Index: the full snapshot minus block-owned text
+		TArray<uint8> Index;
+		FSnapshotWriter::WriteStructure(Source, [&Owners](int32 LocIdx) { return Owners[LocIdx] >= 0; }, Index);
+
+		// Compress each region independently so blocks stay randomly accessible
+		if (!CompressRegion(Index, CompressionFormat))
+		{
+			return false;
+		}
+		for (TArray<uint8>& Block : Blocks)
+		{
+			if (!CompressRegion(Block, CompressionFormat))
+			{
+				return false;
+			}
+		}
+
+		// 4. Lay out offsets, then write everything in order
+		auto AlignUp = [](uint32 Value) { return Align(Value, Alignment); };
+
+		FGSChunkedHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.BlockCount = Blocks.Num();
+		Header.LocalizationCount = LocalizationCount;
+		Header.IndexOffset = AlignUp(6 * sizeof(uint32) + Entries.Num() * 3 * sizeof(uint32) + LocalizationCount * sizeof(int32));
+		Header.IndexSize = Index.Num();
+
+		uint32 Offset = AlignUp(Header.IndexOffset + Header.IndexSize);
+		for (int32 i = 0; i < Blocks.Num(); ++i)
+		{
+			Entries[i].Offset = Offset;
+			Entries[i].Size = Blocks[i].Num();
+			Offset = AlignUp(Offset + Entries[i].Size);
+		}
+
+		OutData.Reset();
+		FMemoryWriter Writer(OutData);
+		Writer << Header;
+		for (FGSChunkedBlockEntry& Entry : Entries)
+		{
+			Writer << Entry;
+		}
+		Writer.Serialize(LocalizationBlocks.GetData(), LocalizationBlocks.Num() * sizeof(int32));
+
+		PadTo(Writer, Alignment);
+		check(Writer.Tell() == Header.IndexOffset);
+		Writer.Serialize(Index.GetData(), Index.Num());
+
+		for (TArray<uint8>& Block : Blocks)
+		{
+			PadTo(Writer, Alignment);
+			Writer.Serialize(Block.GetData(), Block.Num());
+		}
+
+		OutBlockCount = Blocks.Num();
+		return true;
+	}
+}
+
+#endif
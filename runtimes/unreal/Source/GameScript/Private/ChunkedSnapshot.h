@@ -0,0 +1,79 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * On-disk layout of a chunked snapshot (.gsc).
+ *
+ * A chunked snapshot splits one locale's .gsb into a resident index and per-conversation
+ * text blocks that are streamed on demand:
+ *
+ *   FGSChunkedHeader
+ *   FGSChunkedBlockEntry[BlockCount]
+ *   int32 LocalizationBlocks[LocalizationCount]   (block index per localization, -1 = resident)
+ *   Index    - full Snapshot with variants stripped from every block-owned localization
+ *   Blocks   - text-only Snapshots (see FSnapshotWriter::WriteTextBlock)
+ *
+ * The index keeps every entity at its original position, so ID maps, jump tables and refs
+ * are identical to the unchunked snapshot. A localization is block-owned only when exactly
+ * one conversation references it; shared text, actor names and unreferenced entries stay
+ * in the index. All integers are little-endian; every buffer offset is 8-byte aligned.
+ *
+ * The index and each block may individually be wrapped in a compressed container
+ * (see CompressedSnapshot.h), so a block is only decompressed when it is streamed in.
+ */
+namespace GameScriptChunked
+{
+	/** 'GSC1' */
+	constexpr uint32 Magic = 0x31435347;
+	constexpr uint32 Version = 1;
+	constexpr uint32 Alignment = 8;
+
+	/** File extension for chunked snapshots (alongside .gsb in the locales directory). */
+	inline const TCHAR* Extension() { return TEXT(".gsc"); }
+}
+
+struct FGSChunkedHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 BlockCount = 0;
+	uint32 LocalizationCount = 0;
+	uint32 IndexOffset = 0;
+	uint32 IndexSize = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGSChunkedHeader& Header)
+	{
+		Ar << Header.Magic << Header.Version << Header.BlockCount;
+		Ar << Header.LocalizationCount << Header.IndexOffset << Header.IndexSize;
+		return Ar;
+	}
+};
+
+struct FGSChunkedBlockEntry
+{
+	int32 ConversationId = -1;
+	uint32 Offset = 0;
+	uint32 Size = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGSChunkedBlockEntry& Entry)
+	{
+		Ar << Entry.ConversationId << Entry.Offset << Entry.Size;
+		return Ar;
+	}
+};
+
+#if WITH_EDITOR
+namespace GameScriptChunked
+{
+	/**
+	 * Pack an exported .gsb buffer into the chunked layout above.
+	 * @param SnapshotData - Contents of a .gsb file (verified before packing)
+	 * @param OutData - Receives the .gsc file contents
+	 * @param OutBlockCount - Number of per-conversation text blocks written
+	 * @param CompressionFormat - FCompression codec for the index and blocks (NAME_None = uncompressed)
+	 * @return False if the source fails verification or compression fails
+	 */
+	bool Pack(const TArray<uint8>& SnapshotData, TArray<uint8>& OutData, int32& OutBlockCount, FName CompressionFormat = NAME_None);
+}
+#endif
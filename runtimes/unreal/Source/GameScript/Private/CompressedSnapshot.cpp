@@ -0,0 +1,197 @@
+#include "CompressedSnapshot.h"
+#include "GameScript.h"
+#include "Misc/Compression.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include <atomic>
+
+namespace GameScriptCompressed
+{
+	// Header is six uint32 fields
+	static constexpr int32 HeaderSize = 6 * sizeof(uint32);
+
+	// Upper bound on a decompressed buffer. The header is read before anything is verified, so its
+	// sizes are bounded here before they drive an allocation (snapshots are int32-addressed anyway).
+	static constexpr uint32 MaxUncompressedSize = 1024 * 1024 * 1024;
+
+	// Stable on-disk codec IDs (FName indices are not stable across runs)
+	static FName CodecToFormat(uint32 Codec)
+	{
+		switch (Codec)
+		{
+		case 1: return NAME_Zlib;
+		case 2: return NAME_Gzip;
+		case 3: return NAME_LZ4;
+		case 4: return NAME_Oodle;
+		default: return NAME_None;
+		}
+	}
+
+	static uint32 FormatToCodec(FName Format)
+	{
+		if (Format == NAME_Zlib) { return 1; }
+		if (Format == NAME_Gzip) { return 2; }
+		if (Format == NAME_LZ4) { return 3; }
+		if (Format == NAME_Oodle) { return 4; }
+		return 0;
+	}
+
+	static bool ReadHeader(TConstArrayView<uint8> Data, FGSCompressedHeader& OutHeader)
+	{
+		if (Data.Num() < HeaderSize)
+		{
+			return false;
+		}
+
+		// FMemoryReader takes a TArray; view the header bytes without copying the payload
+		TArray<uint8> HeaderBytes(Data.GetData(), HeaderSize);
+		FMemoryReader Reader(HeaderBytes);
+		Reader << OutHeader;
+		return OutHeader.Magic == Magic && OutHeader.Version == Version;
+	}
+
+	bool IsCompressed(TConstArrayView<uint8> Data)
+	{
+		FGSCompressedHeader Header;
+		return ReadHeader(Data, Header);
+	}
+
+	bool Decompress(TConstArrayView<uint8> Data, TArray<uint8>& OutData)
+	{
+		FGSCompressedHeader Header;
+		if (!ReadHeader(Data, Header))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Compressed snapshot header is invalid"));
+			return false;
+		}
+
+		const FName Format = CodecToFormat(Header.Codec);
+		const int64 PayloadOffset = HeaderSize + static_cast<int64>(Header.BlockCount) * sizeof(uint32);
+		const uint32 ExpectedBlocks = Header.BlockSize > 0 ? FMath::DivideAndRoundUp(Header.UncompressedSize, Header.BlockSize) : 0;
+		if (Header.UncompressedSize > MaxUncompressedSize || Header.BlockSize > MaxUncompressedSize)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Compressed snapshot size is out of range (%u bytes in %u-byte blocks)"),
+				Header.UncompressedSize, Header.BlockSize);
+			return false;
+		}
+		if (Format.IsNone() || !FCompression::IsFormatValid(Format) || Header.BlockCount != ExpectedBlocks || PayloadOffset > Data.Num())
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Compressed snapshot layout is corrupt (codec %u, %u blocks)"), Header.Codec, Header.BlockCount);
+			return false;
+		}
+
+		TArray<uint32> BlockEnds;
+		BlockEnds.SetNumUninitialized(Header.BlockCount);
+		FMemory::Memcpy(BlockEnds.GetData(), Data.GetData() + HeaderSize, Header.BlockCount * sizeof(uint32));
+
+		// Offsets must be monotonic and inside the payload, and each block's compressed size must be
+		// one the codec could have produced for its raw size (so the header cannot claim far more
+		// output than the payload holds)
+		const int64 PayloadSize = Data.Num() - PayloadOffset;
+		uint32 PreviousEnd = 0;
+		for (uint32 BlockIdx = 0; BlockIdx < Header.BlockCount; ++BlockIdx)
+		{
+			const uint32 End = BlockEnds[BlockIdx];
+			const int32 RawSize = FMath::Min(Header.BlockSize, Header.UncompressedSize - BlockIdx * Header.BlockSize);
+			const int64 CompressedSize = static_cast<int64>(End) - PreviousEnd;
+			if (End < PreviousEnd || End > PayloadSize
+				|| CompressedSize == 0 || CompressedSize > FCompression::CompressMemoryBound(Format, RawSize))
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Compressed snapshot block table is corrupt (block %u)"), BlockIdx);
+				return false;
+			}
+			PreviousEnd = End;
+		}
+
+		OutData.SetNumUninitialized(Header.UncompressedSize);
+
+		// Blocks are independent - decompress them in parallel straight into the output buffer
+		const uint8* Payload = Data.GetData() + PayloadOffset;
+		std::atomic<bool> bFailed{false};
+		ParallelFor(Header.BlockCount, [&](int32 BlockIdx)
+		{
+			const uint32 Start = BlockIdx > 0 ? BlockEnds[BlockIdx - 1] : 0;
+			const int32 CompressedSize = BlockEnds[BlockIdx] - Start;
+			const uint32 RawOffset = BlockIdx * Header.BlockSize;
+			const int32 RawSize = FMath::Min(Header.BlockSize, Header.UncompressedSize - RawOffset);
+
+			if (CompressedSize == RawSize)
+			{
+				FMemory::Memcpy(OutData.GetData() + RawOffset, Payload + Start, RawSize);
+			}
+			else if (!FCompression::UncompressMemory(Format, OutData.GetData() + RawOffset, RawSize, Payload + Start, CompressedSize))
+			{
+				bFailed = true;
+			}
+		}, Header.BlockCount > 1 ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+		if (bFailed)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to decompress snapshot block (%s)"), *Format.ToString());
+			return false;
+		}
+
+		return true;
+	}
+
+#if WITH_EDITOR
+	bool Compress(TConstArrayView<uint8> Data, TArray<uint8>& OutData, FName Format, uint32 BlockSize)
+	{
+		const uint32 Codec = FormatToCodec(Format);
+		if (Codec == 0 || BlockSize == 0 || !FCompression::IsFormatValid(Format))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Unsupported snapshot compression format: %s"), *Format.ToString());
+			return false;
+		}
+
+		FGSCompressedHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.Codec = Codec;
+		Header.BlockSize = BlockSize;
+		Header.UncompressedSize = Data.Num();
+		Header.BlockCount = FMath::DivideAndRoundUp<uint32>(Data.Num(), BlockSize);
+
+		TArray<TArray<uint8>> Blocks;
+		Blocks.SetNum(Header.BlockCount);
+		ParallelFor(Header.BlockCount, [&](int32 BlockIdx)
+		{
+			const uint32 RawOffset = BlockIdx * BlockSize;
+			const int32 RawSize = FMath::Min<uint32>(BlockSize, Data.Num() - RawOffset);
+			TArray<uint8>& Block = Blocks[BlockIdx];
+
+			int32 CompressedSize = FCompression::CompressMemoryBound(Format, RawSize);
+			Block.SetNumUninitialized(CompressedSize);
+			if (FCompression::CompressMemory(Format, Block.GetData(), CompressedSize, Data.GetData() + RawOffset, RawSize)
+				&& CompressedSize < RawSize)
+			{
+				Block.SetNum(CompressedSize);
+			}
+			else
+			{
+				// Incompressible - store raw (equal sizes mark a raw block)
+				Block.SetNumUninitialized(RawSize);
+				FMemory::Memcpy(Block.GetData(), Data.GetData() + RawOffset, RawSize);
+			}
+		});
+
+		OutData.Reset();
+		FMemoryWriter Writer(OutData);
+		Writer << Header;
+
+		uint32 End = 0;
+		for (const TArray<uint8>& Block : Blocks)
+		{
+			End += Block.Num();
+			Writer << End;
+		}
+		for (TArray<uint8>& Block : Blocks)
+		{
+			Writer.Serialize(Block.GetData(), Block.Num());
+		}
+
+		return true;
+	}
+#endif
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Block-compressed container for snapshot buffers (.gsz, and streamed .gsc blocks).
+ *
+ * The payload is split into fixed-size blocks that are compressed independently with an
+ * FCompression codec, so any block can be decompressed on its own and a whole buffer can be
+ * decompressed in parallel:
+ *
+ *   FGSCompressedHeader
+ *   uint32 BlockEnds[BlockCount]   (end of each compressed block, relative to payload start)
+ *   Payload                        (compressed blocks back to back)
+ *
+ * A block whose compressed size equals its raw size is stored uncompressed.
+ * The decompressed result is byte-identical to the source .gsb, so manifest hashes still apply.
+ */
+namespace GameScriptCompressed
+{
+	/** 'GSZ1' */
+	constexpr uint32 Magic = 0x315A5347;
+	constexpr uint32 Version = 1;
+	constexpr uint32 DefaultBlockSize = 64 * 1024;
+
+	/** File extension for compressed snapshots (alongside .gsb in the locales directory). */
+	inline const TCHAR* Extension() { return TEXT(".gsz"); }
+
+	/** Check whether a buffer starts with a compressed container header. */
+	bool IsCompressed(TConstArrayView<uint8> Data);
+
+	/**
+	 * Decompress a container into a contiguous buffer (blocks decompressed in parallel).
+	 * @return False if the header is invalid or any block fails to decompress
+	 */
+	bool Decompress(TConstArrayView<uint8> Data, TArray<uint8>& OutData);
+
+#if WITH_EDITOR
+	/**
+	 * Compress a buffer into a container.
+	 * @param Format - FCompression codec (e.g., NAME_Oodle, NAME_Zlib)
+	 */
+	bool Compress(TConstArrayView<uint8> Data, TArray<uint8>& OutData, FName Format, uint32 BlockSize = DefaultBlockSize);
+#endif
+}
+
+struct FGSCompressedHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 Codec = 0;
+	uint32 BlockSize = 0;
+	uint32 UncompressedSize = 0;
+	uint32 BlockCount = 0;
+
+	friend FArchive& operator<<(FArchive& Ar, FGSCompressedHeader& Header)
+	{
+		Ar << Header.Magic << Header.Version << Header.Codec;
+		Ar << Header.BlockSize << Header.UncompressedSize << Header.BlockCount;
+		return Ar;
+	}
+};
@@ -0,0 +1,95 @@
+#include "ConversationRecorder.h"
+#include "GameScript.h"
+#include "HAL/FileManager.h"
+
+namespace
+{
+	/** 'GSR1' */
+	constexpr uint32 RecordingMagic = 0x31525347;
+}
+
+FGSConversationRecorder::FGSConversationRecorder()
+{
+	NanosecondsPerCycle = FPlatformTime::GetSecondsPerCycle64() * 1e9;
+}
+
+void FGSConversationRecorder::SetCapacity(int32 Capacity)
+{
+	const int32 Rounded = Capacity > 0 ? static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(Capacity))) : 0;
+	Ring.SetNum(Rounded);
+	Ring.Shrink();
+	Mask = Rounded > 0 ? Rounded - 1 : 0;
+	Head = 0;
+}
+
+void FGSConversationRecorder::GetEvents(TArray<FGSRecordedEvent>& OutEvents) const
+{
+	const uint64 Count = FMath::Min<uint64>(Head, Ring.Num());
+	OutEvents.Reset(static_cast<int32>(Count));
+	for (uint64 i = Head - Count; i < Head; ++i)
+	{
+		OutEvents.Add(Ring[static_cast<int32>(i & Mask)]);
+	}
+}
+
+bool FGSConversationRecorder::SaveToFile(const FString& Path) const
+{
+	TArray<FGSRecordedEvent> Events;
+	GetEvents(Events);
+
+	TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Writer)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to create conversation recording: %s"), *Path);
+		return false;
+	}
+
+	uint32 Magic = RecordingMagic;
+	int32 Count = Events.Num();
+	*Writer << Magic << Count;
+	for (FGSRecordedEvent& Event : Events)
+	{
+		*Writer << Event;
+	}
+	return Writer->Close();
+}
+
+bool FGSConversationRecorder::LoadFromFile(const FString& Path, TArray<FGSRecordedEvent>& OutEvents)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to open conversation recording: %s"), *Path);
+		return false;
+	}
+
+	uint32 Magic = 0;
+	int32 Count = 0;
+	*Reader << Magic << Count;
+
+	// Each serialized event is at least 21 bytes; reject counts the file cannot hold
+	if (Reader->IsError() || Magic != RecordingMagic || Count < 0 || Count > Reader->TotalSize() / 21)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Invalid conversation recording: %s"), *Path);
+		return false;
+	}
+
+	OutEvents.SetNum(Count);
+	for (FGSRecordedEvent& Event : OutEvents)
+	{
+		*Reader << Event;
+	}
+	return !Reader->IsError();
+}
+
+int32 FGSConversationRecorder::FindLastStart(TConstArrayView<FGSRecordedEvent> Events, int32 ContextId)
+{
+	for (int32 i = Events.Num() - 1; i >= 0; --i)
+	{
+		if (Events[i].Type == EGSRecordedEvent::Start && Events[i].ContextId == ContextId)
+		{
+			return i;
+		}
+	}
+	return INDEX_NONE;
+}
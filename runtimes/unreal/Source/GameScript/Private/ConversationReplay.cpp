@@ -0,0 +1,150 @@
+#include "ConversationReplay.h"
+#include "GameScript.h"
+#include "Async/Async.h"
+
+// ---------------------------------------------------------------------------
+// FGSReplayScript
+// ---------------------------------------------------------------------------
+
+void FGSReplayScript::Build(TConstArrayView<FGSRecordedEvent> Events, int32 StartIndex)
+{
+	const int32 ContextId = Events[StartIndex].ContextId;
+	for (int32 i = StartIndex + 1; i < Events.Num(); ++i)
+	{
+		const FGSRecordedEvent& Event = Events[i];
+		if (Event.ContextId != ContextId)
+		{
+			continue;
+		}
+		if (Event.Type == EGSRecordedEvent::Start)
+		{
+			// Pooled context reused for a later conversation
+			break;
+		}
+
+		if (Event.Type == EGSRecordedEvent::Condition)
+		{
+			Conditions.Add({ Event.NodeId, Event.Value != 0 });
+		}
+		else if (Event.Type == EGSRecordedEvent::Choice)
+		{
+			Choices.Add(Event.NodeId);
+		}
+	}
+}
+
+bool FGSReplayScript::NextCondition(int32 NodeId)
+{
+	if (!Conditions.IsValidIndex(ConditionCursor) || Conditions[ConditionCursor].NodeId != NodeId)
+	{
+		if (!bDiverged)
+		{
+			UE_LOG(LogGameScript, Warning, TEXT("Replay diverged: condition on node %d was not recorded here - treating it as failed"), NodeId);
+		}
+		bDiverged = true;
+		return false;
+	}
+	return Conditions[ConditionCursor++].bPassed;
+}
+
+// ---------------------------------------------------------------------------
+// UGSReplayListener
+// ---------------------------------------------------------------------------
+
+namespace
+{
+	// Every completion runs as its own game-thread task, so the stack unwinds between events
+	void NotifyReadyNextTick(const FGSCompletionToken& Token)
+	{
+		AsyncTask(ENamedThreads::GameThread, [Token]()
+		{
+			Token.NotifyReady();
+		});
+	}
+}
+
+void UGSReplayListener::Initialize(TSharedPtr<FGSReplayScript> InScript)
+{
+	Script = MoveTemp(InScript);
+	bFinished = false;
+}
+
+int32 UGSReplayListener::FindRecordedChoice(TConstArrayView<FChoiceRef> Choices)
+{
+	if (Script->Choices.IsValidIndex(Script->ChoiceCursor))
+	{
+		const int32 NodeId = Script->Choices[Script->ChoiceCursor++];
+		const int32 Index = Choices.IndexOfByPredicate([NodeId](const FChoiceRef& Choice) { return Choice.GetId() == NodeId; });
+		if (Index != INDEX_NONE)
+		{
+			return Index;
+		}
+		UE_LOG(LogGameScript, Warning, TEXT("Replay diverged: recorded choice (node %d) is not offered - taking the first choice"), NodeId);
+	}
+	else
+	{
+		UE_LOG(LogGameScript, Warning, TEXT("Replay diverged: recording has no further choices - taking the first choice"));
+	}
+
+	Script->bDiverged = true;
+	return 0;
+}
+
+void UGSReplayListener::OnConversationEnter(const FConversationRef& Conversation, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnNodeEnter(const FNodeRef& Node, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnSpeech(const FNodeRef& Node, const FString& VoiceText, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnDecision(TConstArrayView<FChoiceRef> Choices, FGSCompletionToken Token)
+{
+	// The choices view is only valid during this call: pick now, complete later
+	const int32 ChoiceIndex = FindRecordedChoice(Choices);
+	AsyncTask(ENamedThreads::GameThread, [Token, ChoiceIndex]()
+	{
+		Token.SelectChoiceByIndex(ChoiceIndex);
+	});
+}
+
+void UGSReplayListener::OnNodeExit(const FNodeRef& Node, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnConversationExit(const FConversationRef& Conversation, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnConversationCancelled(const FConversationRef& Conversation, FGSCompletionToken Token)
+{
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnError(const FConversationRef& Conversation, const FString& ErrorMessage, FGSCompletionToken Token)
+{
+	UE_LOG(LogGameScript, Warning, TEXT("Replay of conversation %d ended with an error: %s"), Conversation.GetId(), *ErrorMessage);
+	NotifyReadyNextTick(Token);
+}
+
+void UGSReplayListener::OnCleanup(const FConversationRef& Conversation, FGSCompletionToken Token)
+{
+	bFinished = true;
+	UE_LOG(LogGameScript, Log, TEXT("Replay of conversation %d finished%s"), Conversation.GetId(),
+		Script->bDiverged ? TEXT(" (diverged from the recording)") : TEXT(""));
+	NotifyReadyNextTick(Token);
+}
+
+FChoiceRef UGSReplayListener::OnAutoDecision(TConstArrayView<FChoiceRef> Choices)
+{
+	return Choices.Num() > 0 ? Choices[FindRecordedChoice(Choices)] : FChoiceRef();
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "IGameScriptListener.h"
+#include "IGameScriptNativeListener.h"
+#include "ConversationRecorder.h"
+#include "ConversationReplay.generated.h"
+
+/**
+ * Condition results and choices of one recorded conversation, consumed in order during replay.
+ * Shared by the replaying context (conditions) and UGSReplayListener (choices).
+ */
+struct FGSReplayScript
+{
+	struct FCondition
+	{
+		int32 NodeId;
+		bool bPassed;
+	};
+
+	TArray<FCondition> Conditions;
+	TArray<int32> Choices;          // Chosen node IDs
+	int32 ConditionCursor = 0;
+	int32 ChoiceCursor = 0;
+	bool bDiverged = false;
+
+	/**
+	 * Build from the events following a Start event (up to the context's next Start).
+	 */
+	void Build(TConstArrayView<FGSRecordedEvent> Events, int32 StartIndex);
+
+	/** Recorded result for the next condition; logs and fails the condition on divergence. */
+	bool NextCondition(int32 NodeId);
+};
+
+/**
+ * Listener that drives a replay: completes every event on the next game-thread tick and picks
+ * recorded choices. If a recorded choice is no longer offered, the divergence is logged and the
+ * first choice is taken.
+ *
+ * Native so it can hold completion tokens: completing inline would enter the next node from inside
+ * the callback, nesting a frame per node for the length of the recording.
+ */
+UCLASS()
+class UGSReplayListener : public UObject, public IGameScriptListener, public IGameScriptNativeListener
+{
+	GENERATED_BODY()
+
+public:
+	void Initialize(TSharedPtr<FGSReplayScript> InScript);
+	bool IsFinished() const { return bFinished; }
+
+	virtual IGameScriptNativeListener* GetNativeListener() override { return this; }
+
+	virtual void OnConversationEnter(const FConversationRef& Conversation, FGSCompletionToken Token) override;
+	virtual void OnNodeEnter(const FNodeRef& Node, FGSCompletionToken Token) override;
+	virtual void OnSpeech(const FNodeRef& Node, const FString& VoiceText, FGSCompletionToken Token) override;
+	virtual void OnDecision(TConstArrayView<FChoiceRef> Choices, FGSCompletionToken Token) override;
+	virtual void OnNodeExit(const FNodeRef& Node, FGSCompletionToken Token) override;
+	virtual void OnConversationExit(const FConversationRef& Conversation, FGSCompletionToken Token) override;
+	virtual void OnConversationCancelled(const FConversationRef& Conversation, FGSCompletionToken Token) override;
+	virtual void OnError(const FConversationRef& Conversation, const FString& ErrorMessage, FGSCompletionToken Token) override;
+	virtual void OnCleanup(const FConversationRef& Conversation, FGSCompletionToken Token) override;
+	virtual FChoiceRef OnAutoDecision(TConstArrayView<FChoiceRef> Choices) override;
+
+private:
+	TSharedPtr<FGSReplayScript> Script;
+	bool bFinished = false;
+
+	/** Index of the next recorded choice in Choices; 0 (and marks the script diverged) if it is not offered. */
+	int32 FindRecordedChoice(TConstArrayView<FChoiceRef> Choices);
+};
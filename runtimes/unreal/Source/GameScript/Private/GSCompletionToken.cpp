@@ -0,0 +1,67 @@
+#include "GSCompletionToken.h"
+#include "GameScriptRunner.h"
+#include "RunnerContext.h"
+#include "Async/Async.h"
+
+namespace
+{
+	// Resolve the token's context on the game thread, or queue the completion there
+	template <typename FunctorType>
+	void CompleteOnGameThread(const FGSCompletionToken& Token, FunctorType&& Completion)
+	{
+		if (!IsInGameThread())
+		{
+			Async(EAsyncExecution::TaskGraphMainThread, [Token, Completion = Forward<FunctorType>(Completion)]()
+			{
+				Completion(Token);
+			});
+			return;
+		}
+		Completion(Token);
+	}
+}
+
+void FGSCompletionToken::NotifyReady() const
+{
+	CompleteOnGameThread(*this, [](const FGSCompletionToken& Token)
+	{
+		UGameScriptRunner* StrongRunner = Token.Runner.Get();
+		if (FRunnerContext* Context = StrongRunner ? StrongRunner->ValidateHandle(Token.Conversation) : nullptr)
+		{
+			Context->OnListenerReady(Token.EventId);
+		}
+	});
+}
+
+void FGSCompletionToken::SelectChoice(FNodeRef Choice) const
+{
+	CompleteOnGameThread(*this, [Choice](const FGSCompletionToken& Token)
+	{
+		UGameScriptRunner* StrongRunner = Token.Runner.Get();
+		if (FRunnerContext* Context = StrongRunner ? StrongRunner->ValidateHandle(Token.Conversation) : nullptr)
+		{
+			Context->OnListenerChoice(Choice, Token.EventId);
+		}
+	});
+}
+
+void FGSCompletionToken::SelectChoiceByIndex(int32 ChoiceIndex) const
+{
+	CompleteOnGameThread(*this, [ChoiceIndex](const FGSCompletionToken& Token)
+	{
+		UGameScriptRunner* StrongRunner = Token.Runner.Get();
+		if (FRunnerContext* Context = StrongRunner ? StrongRunner->ValidateHandle(Token.Conversation) : nullptr)
+		{
+			Context->OnListenerChoiceByIndex(ChoiceIndex, Token.EventId);
+		}
+	});
+}
+
+bool FGSCompletionToken::IsValid() const
+{
+	check(IsInGameThread());
+
+	UGameScriptRunner* StrongRunner = Runner.Get();
+	const FRunnerContext* Context = StrongRunner ? StrongRunner->ValidateHandle(Conversation) : nullptr;
+	return Context && Context->IsAwaitingListener(EventId);
+}
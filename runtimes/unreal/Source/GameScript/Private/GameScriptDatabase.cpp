@@ -1,8 +1,18 @@
 #include "GameScriptDatabase.h"
 #include "GameScript.h"
 #include "GameScriptManifest.h"
+#include "GameScriptSettings.h"
+#include "ChunkedSnapshot.h"
+#include "CompressedSnapshot.h"
+#include "SplitSnapshot.h"
+#include "SnapshotPatch.h"
+#include "Sha256.h"
+#include "TextResolver.h"
+#include "PropertyColumn.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "Async/Async.h"
 #include "Generated/snapshot_generated.h"
 
 UGameScriptDatabase::UGameScriptDatabase()
@@ -11,20 +21,130 @@ UGameScriptDatabase::UGameScriptDatabase()
 
 UGameScriptDatabase::~UGameScriptDatabase()
 {
-	// FlatBuffers snapshot pointer is just a cast into SnapshotBuffer
-	// No explicit cleanup needed
+	// FlatBuffers snapshot pointer is just a cast into the pinned version's buffer
+	// Only a background verification still reading the buffer needs to finish
+	WaitForBackgroundVerification();
+
+	if (HotReloadTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(HotReloadTicker);
+	}
+	if (ReclaimTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReclaimTicker);
+	}
 }
 
-bool UGameScriptDatabase::LoadSnapshot(const FString& SnapshotPath)
+bool UGameScriptDatabase::LoadSnapshot(const FString& SnapshotPath, const FString& ExpectedHash)
 {
+	// Chunked snapshots only load their index up front
+	if (SnapshotPath.EndsWith(GameScriptChunked::Extension()))
+	{
+		return LoadChunkedSnapshot(SnapshotPath);
+	}
+
+	// String tables load against the shared structure
+	if (SnapshotPath.EndsWith(GameScriptSplit::StringTableExtension()))
+	{
+		return LoadSplitSnapshot(SnapshotPath);
+	}
+
 	// Load into temporary buffer first to preserve current state on failure
 	TArray<uint8> TempBuffer;
-	if (!FFileHelper::LoadFileToArray(TempBuffer, *SnapshotPath))
+	bool bVerifyPending = false;
+	if (!ReadSnapshotFile(SnapshotPath, TempBuffer, ExpectedHash, &bVerifyPending))
+	{
+		return false;
+	}
+
+	CommitSnapshot(MoveTemp(TempBuffer), SnapshotPath, bVerifyPending);
+	return true;
+}
+
+bool UGameScriptDatabase::ReadSnapshotFile(const FString& SnapshotPath, TArray<uint8>& OutBuffer,
+	const FString& ExpectedHash, bool* bOutVerifyPending)
+{
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+	const bool bCheckHash = Settings->bTrustManifestHash && !ExpectedHash.IsEmpty();
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SnapshotPath));
+	const int64 FileSize = Reader ? Reader->TotalSize() : -1;
+	if (FileSize < 0 || FileSize > MAX_int32)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshot file: %s"), *SnapshotPath);
+		return false;
+	}
+
+	// Read in chunks, hashing each while it is still in cache (raw snapshots only -
+	// the manifest hash covers uncompressed bytes)
+	static constexpr int64 ReadChunkSize = 1024 * 1024;
+	TArray<uint8> TempBuffer;
+	TempBuffer.SetNumUninitialized(static_cast<int32>(FileSize));
+	FGSSha256 Hasher;
+	bool bHashWhileReading = bCheckHash;
+	for (int64 Offset = 0; Offset < FileSize;)
+	{
+		const int64 Count = FMath::Min(FileSize - Offset, ReadChunkSize);
+		Reader->Serialize(TempBuffer.GetData() + Offset, Count);
+		if (Offset == 0)
+		{
+			bHashWhileReading &= !GameScriptCompressed::IsCompressed(MakeArrayView(TempBuffer.GetData(), static_cast<int32>(Count)));
+		}
+		if (bHashWhileReading)
+		{
+			Hasher.Update(TempBuffer.GetData() + Offset, Count);
+		}
+		Offset += Count;
+	}
+	if (!Reader->Close())
 	{
 		UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshot file: %s"), *SnapshotPath);
 		return false;
 	}
 
+	// Compressed snapshots (.gsz) decompress in parallel into the snapshot buffer
+	if (GameScriptCompressed::IsCompressed(TempBuffer))
+	{
+		TArray<uint8> RawBuffer;
+		if (!GameScriptCompressed::Decompress(TempBuffer, RawBuffer))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to decompress snapshot: %s"), *SnapshotPath);
+			return false;
+		}
+		TempBuffer = MoveTemp(RawBuffer);
+		if (bCheckHash)
+		{
+			Hasher.Update(TempBuffer.GetData(), TempBuffer.Num());
+		}
+	}
+
+	// Trusted builds: an exact match with the manifest stands in for structural verification
+	if (bCheckHash)
+	{
+		const FString ActualHash = Hasher.FinalHex();
+		if (ActualHash.Equals(ExpectedHash, ESearchCase::IgnoreCase)
+			&& TempBuffer.Num() > 8 && GameScript::SnapshotBufferHasIdentifier(TempBuffer.GetData()))
+		{
+			OutBuffer = MoveTemp(TempBuffer);
+			return true;
+		}
+		UE_LOG(LogGameScript, Warning, TEXT("Snapshot does not match manifest hash, verifying: %s"), *SnapshotPath);
+	}
+
+	// Background policy: the caller commits now and verifies on a worker thread. Committing builds
+	// the indices, so the fields they read are bounds-checked here first.
+	if (bOutVerifyPending && Settings->SnapshotVerification == EGSSnapshotVerification::Background)
+	{
+		if (!FGSSnapshotStructure::VerifyIndexedFields(TempBuffer))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Snapshot verification failed: %s"), *SnapshotPath);
+			return false;
+		}
+		*bOutVerifyPending = true;
+		OutBuffer = MoveTemp(TempBuffer);
+		return true;
+	}
+
 	// Verify before committing
 	flatbuffers::Verifier Verifier(TempBuffer.GetData(), TempBuffer.Num());
 	if (!GameScript::VerifySnapshotBuffer(Verifier))
@@ -33,19 +153,247 @@ bool UGameScriptDatabase::LoadSnapshot(const FString& SnapshotPath)
 		return false;
 	}
 
-	// Verification passed - now commit the change
-	// Invalidate old snapshot pointer first (it points into old buffer)
-	Snapshot = nullptr;
-
-	// Move temp buffer to member (efficient, no copy)
-	SnapshotBuffer = MoveTemp(TempBuffer);
+	OutBuffer = MoveTemp(TempBuffer);
+	return true;
+}
 
-	// Set new snapshot pointer
-	Snapshot = GameScript::GetSnapshot(SnapshotBuffer.GetData());
+void UGameScriptDatabase::CommitSnapshot(TArray<uint8>&& Buffer, const FString& SnapshotPath, bool bVerifyPending,
+	TArray<uint8>&& TableBuffer)
+{
+	// A background check or worker-thread readers may still be reading the buffer we are about to replace
+	WaitForBackgroundVerification();
+	OnSnapshotMemoryReleasing.Broadcast();
+
+	// Move temp buffer into a new structure (efficient, no copy) and build ID-to-index maps for fast lookups
+	TSharedRef<const FGSSnapshotStructure, ESPMode::ThreadSafe> Structure =
+		MakeShared<const FGSSnapshotStructure, ESPMode::ThreadSafe>(MoveTemp(Buffer));
+	PublishVersion(new FGSSnapshotVersion(Structure, MoveTemp(TableBuffer)));
+	CurrentStructurePath.Empty();
 	CurrentSnapshotPath = SnapshotPath;
 
-	// Build ID-to-index maps for fast lookups
-	BuildIdMaps();
+	// All text is resident until a chunked load says otherwise
+	ResetStreamingState();
+
+	// Resident locales must still line up with the new structure
+	for (auto It = ResidentLocales.CreateIterator(); It; ++It)
+	{
+		if (!GameScriptSplit::IsCompatible(Snapshot, It->Value.Text))
+		{
+			UE_LOG(LogGameScript, Warning, TEXT("Dropping resident locale %d - its text no longer matches the loaded snapshot"), It->Key);
+			It.RemoveCurrent();
+		}
+	}
+
+	if (bVerifyPending)
+	{
+		StartBackgroundVerification();
+	}
+}
+
+void UGameScriptDatabase::UnloadSnapshot()
+{
+	// Refs still resolve while Unloading is handled; nothing is loaded once Unloaded fires
+	OnSnapshotUnloading.Broadcast();
+
+	WaitForBackgroundVerification();
+	OnSnapshotMemoryReleasing.Broadcast();
+
+	PublishVersion(nullptr);
+	CurrentStructurePath.Empty();
+	CurrentSnapshotPath.Empty();
+	ResetStreamingState();
+
+	OnSnapshotUnloaded.Broadcast();
+}
+
+void UGameScriptDatabase::PublishVersion(FGSSnapshotPin NewVersion)
+{
+	check(IsInGameThread());
+
+	FGSSnapshotPin OldVersion = MoveTemp(CurrentVersion);
+	CurrentVersion = MoveTemp(NewVersion);
+	PublishedVersion.store(CurrentVersion.GetReference());
+
+	// A reader may have loaded the old pointer without having taken its reference yet, so the old
+	// version is kept until its grace period ends; polled on the core ticker rather than waited for
+	if (OldVersion)
+	{
+		RetiredVersions.Add(OldVersion);
+	}
+	if (ReclaimRetiredVersions() && !ReclaimTicker.IsValid())
+	{
+		ReclaimTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+		{
+			const bool bPending = ReclaimRetiredVersions();
+			if (!bPending)
+			{
+				ReclaimTicker.Reset();
+			}
+			return bPending;
+		}));
+	}
+
+	Snapshot = CurrentVersion ? CurrentVersion->GetSnapshot() : nullptr;
+	StringTable = CurrentVersion ? CurrentVersion->StringTable : nullptr;
+
+	// Property columns index the structure; string table swaps keep them
+	if (!OldVersion || !CurrentVersion || &OldVersion->Structure.Get() != &CurrentVersion->Structure.Get())
+	{
+		PropertyColumns.Reset();
+	}
+
+	// The text index covers one version's text
+	if (TextSearchIndex.IsValid() && (!CurrentVersion || TextSearchIndex->GetVersion() != CurrentVersion->GetVersion()))
+	{
+		TextSearchIndex.Reset();
+	}
+	if (bKeepTextSearchIndex || GetDefault<UGameScriptSettings>()->bBuildTextSearchIndex)
+	{
+		StartTextSearchBuild();
+	}
+
+	// OldVersion is freed after its grace period, or when its last reader releases its pin
+}
+
+bool UGameScriptDatabase::ReclaimRetiredVersions()
+{
+	check(IsInGameThread());
+
+	// Every reader that could still be pinning a grace-period version is counted in GraceEpoch:
+	// once that slot drains, they all hold their references (all accesses sequentially consistent)
+	if (GracePeriodVersions.Num() > 0 && PinnersInEpoch[GraceEpoch].load() == 0)
+	{
+		GracePeriodVersions.Reset();
+	}
+
+	// Open a grace period for the retired versions by flipping the epoch. The incoming slot must be
+	// empty: a reader that counts itself there after this check loads the pointer after the publish,
+	// so it can only see the current version
+	const uint32 Epoch = PinEpoch.load();
+	if (GracePeriodVersions.Num() == 0 && RetiredVersions.Num() > 0 && PinnersInEpoch[Epoch ^ 1].load() == 0)
+	{
+		PinEpoch.store(Epoch ^ 1);
+		GraceEpoch = Epoch;
+		GracePeriodVersions = MoveTemp(RetiredVersions);
+		if (PinnersInEpoch[GraceEpoch].load() == 0)
+		{
+			GracePeriodVersions.Reset();
+		}
+	}
+
+	return GracePeriodVersions.Num() > 0 || RetiredVersions.Num() > 0;
+}
+
+FGSSnapshotPin UGameScriptDatabase::PinSnapshot() const
+{
+	// Counted in the slot of the epoch read first, from before the load until the reference is held
+	const uint32 Epoch = PinEpoch.load();
+	PinnersInEpoch[Epoch].fetch_add(1);
+	FGSSnapshotPin Pin(PublishedVersion.load());
+	PinnersInEpoch[Epoch].fetch_sub(1);
+	return Pin;
+}
+
+const FGSSnapshotStructure& UGameScriptDatabase::GetStructure() const
+{
+	static const FGSSnapshotStructure Empty;
+	return CurrentVersion ? *CurrentVersion->Structure : Empty;
+}
+
+void UGameScriptDatabase::StartBackgroundVerification()
+{
+	TSharedRef<const FGSSnapshotStructure, ESPMode::ThreadSafe> Structure = CurrentVersion->Structure;
+	const uint32 Generation = ++VerificationGeneration;
+	const FString Path = CurrentSnapshotPath;
+	TWeakObjectPtr<UGameScriptDatabase> WeakThis(this);
+
+	PendingVerification = Async(EAsyncExecution::ThreadPool, [WeakThis, Structure, Generation, Path]()
+	{
+		flatbuffers::Verifier Verifier(Structure->Buffer.GetData(), Structure->Buffer.Num());
+		const bool bValid = GameScript::VerifySnapshotBuffer(Verifier);
+		if (!bValid)
+		{
+			Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, Generation, Path]()
+			{
+				UGameScriptDatabase* This = WeakThis.Get();
+				if (!This || This->VerificationGeneration != Generation)
+				{
+					// Database was destroyed or reloaded since
+					return;
+				}
+
+				UE_LOG(LogGameScript, Error, TEXT("Background snapshot verification failed, unloading: %s"), *Path);
+				This->UnloadSnapshot();
+			});
+		}
+		return bValid;
+	});
+}
+
+void UGameScriptDatabase::WaitForBackgroundVerification()
+{
+	if (PendingVerification.IsValid())
+	{
+		PendingVerification.Wait();
+		PendingVerification.Reset();
+	}
+}
+
+bool UGameScriptDatabase::LoadSplitSnapshot(const FString& StringTablePath)
+{
+	// Switching locale within the same structure keeps it, the ID maps and jump tables resident
+	const FString StructurePath = GameScriptSplit::GetStructurePathForStringTable(StringTablePath);
+	const bool bStructureResident = StringTable && CurrentStructurePath == StructurePath;
+
+	FSnapshotFiles Files;
+	bool bVerifyPending = false;
+	return ReadSplitSnapshot(StringTablePath, !bStructureResident, Files, &bVerifyPending)
+		&& CommitSplitSnapshot(StringTablePath, MoveTemp(Files), bVerifyPending);
+}
+
+bool UGameScriptDatabase::ReadSplitSnapshot(const FString& StringTablePath, bool bReadStructure, FSnapshotFiles& OutFiles,
+	bool* bOutVerifyPending)
+{
+	if (!ReadSnapshotFile(StringTablePath, OutFiles.StringTable))
+	{
+		return false;
+	}
+	const FString StructurePath = GameScriptSplit::GetStructurePathForStringTable(StringTablePath);
+	return !bReadStructure || ReadSnapshotFile(StructurePath, OutFiles.Structure, FString(), bOutVerifyPending);
+}
+
+bool UGameScriptDatabase::CommitSplitSnapshot(const FString& StringTablePath, FSnapshotFiles&& Files, bool bVerifyPending)
+{
+	check(IsInGameThread());
+
+	const FString StructurePath = GameScriptSplit::GetStructurePathForStringTable(StringTablePath);
+	const bool bStructureResident = Files.Structure.Num() == 0;
+	if (bStructureResident && !StringTable)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("No structure loaded for string table %s"), *StringTablePath);
+		return false;
+	}
+
+	const GameScript::Snapshot* Structure = bStructureResident ? Snapshot : GameScript::GetSnapshot(Files.Structure.GetData());
+	if (!GameScriptSplit::IsCompatible(Structure, GameScript::GetSnapshot(Files.StringTable.GetData())))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("String table %s does not match structure %s - re-split the export"),
+			*StringTablePath, *StructurePath);
+		return false;
+	}
+
+	if (bStructureResident)
+	{
+		// New version sharing the structure; pinned readers keep the old string table
+		OnSnapshotMemoryReleasing.Broadcast();
+		PublishVersion(new FGSSnapshotVersion(CurrentVersion->Structure, MoveTemp(Files.StringTable)));
+	}
+	else
+	{
+		CommitSnapshot(MoveTemp(Files.Structure), StructurePath, bVerifyPending, MoveTemp(Files.StringTable));
+		CurrentStructurePath = StructurePath;
+	}
+	CurrentSnapshotPath = StringTablePath;
 
 	return true;
 }
@@ -98,7 +446,7 @@ bool UGameScriptDatabase::ChangeLocale(FLocaleRef NewLocale)
 	}
 
 	// Build snapshot path (using locale Name to match how snapshots are exported)
-	FString NewSnapshotPath = FPaths::Combine(BasePath, TEXT("locales"), LocaleMetadata.Name + TEXT(".gsb"));
+	FString NewSnapshotPath = ManifestPtr->GetSnapshotPath(NewLocale.Index);
 
 	UE_LOG(LogGameScript, Log, TEXT("Attempting to change locale to %s (index %d, id %d) at path: %s"),
 		*LocaleMetadata.Name, NewLocale.Index, LocaleMetadata.Id, *NewSnapshotPath);
@@ -111,7 +459,7 @@ bool UGameScriptDatabase::ChangeLocale(FLocaleRef NewLocale)
 	}
 
 	// Load new snapshot
-	if (!LoadSnapshot(NewSnapshotPath))
+	if (!LoadSnapshot(NewSnapshotPath, LocaleMetadata.Hash))
 	{
 		UE_LOG(LogGameScript, Error, TEXT("Failed to load snapshot for locale %s at %s"), *LocaleMetadata.Name, *NewSnapshotPath);
 		return false;
@@ -122,218 +470,1311 @@ bool UGameScriptDatabase::ChangeLocale(FLocaleRef NewLocale)
 	// Track current locale index
 	CurrentLocaleIndex = NewLocale.Index;
 
-	// Note: ID maps are automatically rebuilt by LoadSnapshot() -> BuildIdMaps()
+	// Text from the new locale's fallback chain (string tables only, under the split layout)
+	RefreshFallbackLocales();
+
+	// Note: ID maps are rebuilt with the new version by LoadSnapshot(), except for split layouts
+	// where only the string table changed and the version shares the structure's maps
 	// Broadcast locale change event
 	OnLocaleChanged.Broadcast();
 
 	return true;
 }
 
-// --- DRY: GetCount() methods use template helper ---
-
-int32 UGameScriptDatabase::GetNodeCount() const
+bool UGameScriptDatabase::ApplySnapshotPatch(FLocaleRef Locale, const FString& PatchPath)
 {
-	return GetCollectionCount(&GameScript::Snapshot::nodes);
-}
+	check(IsInGameThread());
 
-int32 UGameScriptDatabase::GetConversationCount() const
-{
-	return GetCollectionCount(&GameScript::Snapshot::conversations);
-}
+	UGameScriptManifest* ManifestPtr = Manifest.Get();
+	if (!Locale.IsValid() || !ManifestPtr)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot apply snapshot patch - invalid locale or no manifest reference"));
+		return false;
+	}
 
-int32 UGameScriptDatabase::GetActorCount() const
-{
-	return GetCollectionCount(&GameScript::Snapshot::actors);
-}
+	const FManifestLocale& LocaleMetadata = ManifestPtr->GetLocaleMetadata(Locale.Index);
+	if (LocaleMetadata.Id < 0 || LocaleMetadata.Hash.IsEmpty())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot apply snapshot patch - locale has no manifest hash"));
+		return false;
+	}
 
-int32 UGameScriptDatabase::GetLocalizationCount() const
-{
-	return GetCollectionCount(&GameScript::Snapshot::localizations);
-}
+	// Base: a previously installed patch if present, else the shipped uncompressed snapshot.
+	// Either way the patch header's base hash decides whether it applies.
+	IFileManager& FileManager = IFileManager::Get();
+	const FString InstalledPath = ManifestPtr->GetPatchedSnapshotPath(Locale.Index);
+	const FString ShippedPath = FPaths::Combine(BasePath, TEXT("locales"), LocaleMetadata.Name + TEXT(".gsb"));
+	const FString BaseSnapshotPath = FPaths::FileExists(InstalledPath) ? InstalledPath : ShippedPath;
+	if (!FPaths::FileExists(BaseSnapshotPath))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot apply snapshot patch - no uncompressed base snapshot at %s"), *BaseSnapshotPath);
+		return false;
+	}
 
-int32 UGameScriptDatabase::GetEdgeCount() const
-{
-	return GetCollectionCount(&GameScript::Snapshot::edges);
-}
+	// Write next to the install location, then swap in only after verification
+	const FString TempPath = InstalledPath + TEXT(".tmp");
+	FileManager.MakeDirectory(*FPaths::GetPath(InstalledPath), true);
 
-int32 UGameScriptDatabase::GetPropertyTemplateCount() const
-{
-	return GetCollectionCount(&GameScript::Snapshot::property_templates);
-}
+	FString ResultHash;
+	if (!GameScriptPatch::Apply(BaseSnapshotPath, PatchPath, TempPath, ResultHash))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to apply snapshot patch %s"), *PatchPath);
+		return false;
+	}
 
-// --- DRY: FindEntity() methods use template helper ---
+	if (!ResultHash.Equals(LocaleMetadata.Hash, ESearchCase::IgnoreCase))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Patched snapshot for %s does not match manifest hash (got %s, expected %s)"),
+			*LocaleMetadata.Name, *ResultHash, *LocaleMetadata.Hash);
+		FileManager.Delete(*TempPath);
+		return false;
+	}
 
-FNodeRef UGameScriptDatabase::FindNode(int32 NodeId) const
-{
-	return FindEntityById<FNodeRef>(NodeIdToIndex, NodeId);
-}
+	// Localization hotfixes only: a structural change would invalidate loaded ID maps and running
+	// conversations. Compared by digest so only one snapshot is held at a time; a live locale is
+	// compared against what is loaded (a split structure or chunked index digests like its .gsb).
+	const bool bLive = Locale.Index == CurrentLocaleIndex && Snapshot;
+	uint8 BaseDigest[FGSSha256::DigestSize];
+	if (bLive)
+	{
+		GameScriptPatch::HashStructure(Snapshot, BaseDigest);
+	}
+	else
+	{
+		TArray<uint8> BaseBuffer;
+		if (!ReadSnapshotFile(BaseSnapshotPath, BaseBuffer))
+		{
+			FileManager.Delete(*TempPath);
+			return false;
+		}
+		GameScriptPatch::HashStructure(GameScript::GetSnapshot(BaseBuffer.GetData()), BaseDigest);
+	}
 
-FConversationRef UGameScriptDatabase::FindConversation(int32 ConversationId) const
-{
-	return FindEntityById<FConversationRef>(ConversationIdToIndex, ConversationId);
-}
+	TArray<uint8> PatchedBuffer;
+	if (!ReadSnapshotFile(TempPath, PatchedBuffer, ResultHash))
+	{
+		FileManager.Delete(*TempPath);
+		return false;
+	}
+	uint8 PatchedDigest[FGSSha256::DigestSize];
+	GameScriptPatch::HashStructure(GameScript::GetSnapshot(PatchedBuffer.GetData()), PatchedDigest);
+	if (FMemory::Memcmp(BaseDigest, PatchedDigest, FGSSha256::DigestSize) != 0)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Rejected snapshot patch %s - it changes more than text (ship structural changes as a full update)"),
+			*PatchPath);
+		FileManager.Delete(*TempPath);
+		return false;
+	}
 
-FActorRef UGameScriptDatabase::FindActor(int32 ActorId) const
-{
-	return FindEntityById<FActorRef>(ActorIdToIndex, ActorId);
-}
+	if (!FileManager.Move(*InstalledPath, *TempPath, true, true)
+		|| !FFileHelper::SaveStringToFile(ResultHash, *(InstalledPath + TEXT(".hash"))))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to install patched snapshot at %s"), *InstalledPath);
+		FileManager.Delete(*TempPath);
+		return false;
+	}
 
-FLocalizationRef UGameScriptDatabase::FindLocalization(int32 LocalizationId) const
-{
-	return FindEntityById<FLocalizationRef>(LocalizationIdToIndex, LocalizationId);
-}
+	UE_LOG(LogGameScript, Log, TEXT("Installed patched snapshot for %s (%s)"), *LocaleMetadata.Name, *ResultHash);
 
-FEdgeRef UGameScriptDatabase::FindEdge(int32 EdgeId) const
-{
-	return FindEntityById<FEdgeRef>(EdgeIdToIndex, EdgeId);
-}
+	// Hot-swap if this locale is live. The patched .gsb replaces any split or chunked layout, as it
+	// would on the next load (the manifest resolves the locale to the installed patch from now on),
+	// so runtime hot reload and locale changes see a plain snapshot.
+	if (bLive)
+	{
+		CommitSnapshot(MoveTemp(PatchedBuffer), InstalledPath);
+		RefreshFallbackLocales();
+		OnLocaleChanged.Broadcast();
+	}
+	else if (const FResidentLocale* Resident = ResidentLocales.Find(Locale.Index))
+	{
+		const bool bRequested = Resident->bRequested;
+		ResidentLocales.Remove(Locale.Index);
+		LoadResidentLocale(Locale.Index, bRequested);
+	}
 
-FPropertyTemplateRef UGameScriptDatabase::FindPropertyTemplate(int32 TemplateId) const
-{
-	return FindEntityById<FPropertyTemplateRef>(PropertyTemplateIdToIndex, TemplateId);
+	return true;
 }
 
-// --- Checked Lookups (log error if not found) ---
+// ---------------------------------------------------------------------------
+// Runtime Hot Reload
+// ---------------------------------------------------------------------------
 
-FNodeRef UGameScriptDatabase::FindNodeChecked(int32 NodeId) const
+void UGameScriptDatabase::SetRuntimeHotReloadEnabled(bool bEnabled)
 {
-	FNodeRef Ref = FindNode(NodeId);
-	if (!Ref.IsValid())
+	check(IsInGameThread());
+
+#if UE_BUILD_SHIPPING
+	if (bEnabled)
 	{
-		UE_LOG(LogGameScript, Error, TEXT("FindNodeChecked: Node with ID %d not found"), NodeId);
+		UE_LOG(LogGameScript, Warning, TEXT("Runtime hot reload is not available in shipping builds"));
 	}
-	return Ref;
+#else
+	if (bEnabled == IsRuntimeHotReloadEnabled())
+	{
+		return;
+	}
+
+	// Drop any background read started under the previous setting
+	++HotReloadGeneration;
+	bHotReloadInFlight = false;
+
+	if (!bEnabled)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(HotReloadTicker);
+		HotReloadTicker.Reset();
+		return;
+	}
+
+	HotReloadPath = CurrentSnapshotPath;
+	HotReloadTimeStamp = GetSnapshotTimeStamp();
+
+	const float Interval = FMath::Max(GetDefault<UGameScriptSettings>()->RuntimeHotReloadInterval, 0.1f);
+	HotReloadTicker = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UGameScriptDatabase::TickRuntimeHotReload), Interval);
+
+	UE_LOG(LogGameScript, Log, TEXT("Runtime hot reload watching %s"), *CurrentSnapshotPath);
+#endif
 }
 
-FConversationRef UGameScriptDatabase::FindConversationChecked(int32 ConversationId) const
+FDateTime UGameScriptDatabase::GetSnapshotTimeStamp() const
 {
-	FConversationRef Ref = FindConversation(ConversationId);
-	if (!Ref.IsValid())
+	// Split layouts are exported as a structure plus string tables; a change to either counts
+	IFileManager& FileManager = IFileManager::Get();
+	FDateTime TimeStamp = FileManager.GetTimeStamp(*CurrentSnapshotPath);
+	if (!CurrentStructurePath.IsEmpty())
+	{
+		TimeStamp = FMath::Max(TimeStamp, FileManager.GetTimeStamp(*CurrentStructurePath));
+	}
+	return TimeStamp;
+}
+
+bool UGameScriptDatabase::TickRuntimeHotReload(float DeltaTime)
+{
+	if (bHotReloadInFlight || CurrentSnapshotPath.IsEmpty())
+	{
+		return true;
+	}
+
+	// Locale change or patch install: watch the new file from its current state
+	if (CurrentSnapshotPath != HotReloadPath)
+	{
+		HotReloadPath = CurrentSnapshotPath;
+		HotReloadTimeStamp = GetSnapshotTimeStamp();
+		return true;
+	}
+
+	// Any change counts (restoring an older export included). A write still in progress
+	// fails verification and is picked up again when the writer touches the file last.
+	const FDateTime TimeStamp = GetSnapshotTimeStamp();
+	if (TimeStamp == HotReloadTimeStamp)
+	{
+		return true;
+	}
+	HotReloadTimeStamp = TimeStamp;
+
+	const FString Path = CurrentSnapshotPath;
+	UE_LOG(LogGameScript, Log, TEXT("Runtime hot reload: %s changed"), *Path);
+
+	// Read, decompress and verify every file of the layout on a worker thread; swap on the game thread
+	bHotReloadInFlight = true;
+	const uint32 Generation = HotReloadGeneration;
+	TWeakObjectPtr<UGameScriptDatabase> WeakThis(this);
+	const bool bChunked = bIsStreaming;
+	const bool bSplit = StringTable != nullptr;
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Path, Generation, bChunked, bSplit]()
+	{
+		// The split structure is re-read along with the string table: both come from one export
+		FSnapshotFiles Files;
+		const bool bRead = bChunked ? ReadChunkedSnapshot(Path, Files)
+			: bSplit ? ReadSplitSnapshot(Path, true, Files)
+			: ReadSnapshotFile(Path, Files.Structure);
+
+		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, Path, Generation, bChunked, bSplit, bRead, Files = MoveTemp(Files)]() mutable
+		{
+			UGameScriptDatabase* This = WeakThis.Get();
+			if (!This || This->HotReloadGeneration != Generation)
+			{
+				// Database was destroyed or hot reload was toggled since
+				return;
+			}
+
+			This->bHotReloadInFlight = false;
+			if (!bRead)
+			{
+				UE_LOG(LogGameScript, Warning, TEXT("Runtime hot reload skipped - keeping the loaded snapshot until %s changes again"), *Path);
+				return;
+			}
+			if (This->CurrentSnapshotPath != Path)
+			{
+				// Locale changed while reading
+				return;
+			}
+
+			This->CommitRuntimeHotReload([This, &Files, &Path, bChunked, bSplit]()
+			{
+				if (bChunked)
+				{
+					This->CommitChunkedSnapshot(Path, MoveTemp(Files));
+					return true;
+				}
+				if (bSplit)
+				{
+					return This->CommitSplitSnapshot(Path, MoveTemp(Files));
+				}
+				This->CommitSnapshot(MoveTemp(Files.Structure), Path);
+				return true;
+			});
+		});
+	});
+
+	return true;
+}
+
+void UGameScriptDatabase::CommitRuntimeHotReload(TFunctionRef<bool()> Reload)
+{
+	check(IsInGameThread());
+
+	OnSnapshotReloading.Broadcast();
+
+	if (Reload())
+	{
+		// Resident and fallback text came from the previous export as well
+		TArray<TPair<int32, bool>> Residents;
+		Residents.Reserve(ResidentLocales.Num());
+		for (const TPair<int32, FResidentLocale>& Pair : ResidentLocales)
+		{
+			Residents.Emplace(Pair.Key, Pair.Value.bRequested);
+		}
+		ResidentLocales.Reset();
+		for (const TPair<int32, bool>& Resident : Residents)
+		{
+			LoadResidentLocale(Resident.Key, Resident.Value);
+		}
+
+		UE_LOG(LogGameScript, Log, TEXT("Runtime hot reload: loaded %s (%d nodes)"), *CurrentSnapshotPath, GetNodeCount());
+	}
+
+	// Broadcast even on failure: listeners re-resolve their IDs against whatever is loaded
+	OnSnapshotReloaded.Broadcast();
+}
+
+// ---------------------------------------------------------------------------
+// Resident Locales
+// ---------------------------------------------------------------------------
+
+bool UGameScriptDatabase::AddResidentLocale(FLocaleRef Locale)
+{
+	check(IsInGameThread());
+
+	if (!Locale.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot add resident locale - invalid locale ref"));
+		return false;
+	}
+
+	if (Locale.Index == CurrentLocaleIndex)
+	{
+		return true;
+	}
+
+	// Already held for the fallback chain - just keep it past the next locale change
+	if (FResidentLocale* Resident = ResidentLocales.Find(Locale.Index))
+	{
+		Resident->bRequested = true;
+		return true;
+	}
+
+	return LoadResidentLocale(Locale.Index, true);
+}
+
+void UGameScriptDatabase::RemoveResidentLocale(FLocaleRef Locale)
+{
+	check(IsInGameThread());
+
+	if (!Locale.IsValid())
+	{
+		return;
+	}
+
+	// Fallbacks of the current locale stay resident
+	if (GetFallbackChain().Contains(Locale.Index))
+	{
+		if (FResidentLocale* Resident = ResidentLocales.Find(Locale.Index))
+		{
+			Resident->bRequested = false;
+		}
+		return;
+	}
+
+	ResidentLocales.Remove(Locale.Index);
+}
+
+bool UGameScriptDatabase::IsLocaleResident(FLocaleRef Locale) const
+{
+	return Locale.IsValid() && (Locale.Index == CurrentLocaleIndex || ResidentLocales.Contains(Locale.Index));
+}
+
+const TArray<int32>& UGameScriptDatabase::GetFallbackChain() const
+{
+	static const TArray<int32> NoFallbacks;
+	const UGameScriptManifest* ManifestPtr = Manifest.Get();
+	return ManifestPtr ? ManifestPtr->GetFallbackChain(CurrentLocaleIndex) : NoFallbacks;
+}
+
+bool UGameScriptDatabase::LoadResidentLocale(int32 LocaleIndex, bool bRequested)
+{
+	UGameScriptManifest* ManifestPtr = Manifest.Get();
+	if (!ManifestPtr || !Snapshot)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot load resident locale - database was not created via Manifest->LoadDatabase()"));
+		return false;
+	}
+
+	const FManifestLocale& LocaleMetadata = ManifestPtr->GetLocaleMetadata(LocaleIndex);
+
+	// Resident text is read whole (streaming applies to the current locale only)
+	const FString TextPath = ManifestPtr->GetSnapshotPath(LocaleIndex, false);
+	FResidentLocale Resident;
+	Resident.bRequested = bRequested;
+	// The manifest hash describes the full .gsb, not a split string table
+	const bool bIsStringTable = TextPath.EndsWith(GameScriptSplit::StringTableExtension());
+	TArray<uint8> TextBuffer;
+	if (!ReadSnapshotFile(TextPath, TextBuffer, bIsStringTable ? FString() : LocaleMetadata.Hash))
+	{
+		return false;
+	}
+
+	Resident.Buffer = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(TextBuffer));
+	Resident.Text = GameScript::GetSnapshot(Resident.Buffer->GetData());
+	if (!GameScriptSplit::IsCompatible(Snapshot, Resident.Text))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Cannot load resident locale %s - %s does not match the loaded snapshot"),
+			*LocaleMetadata.Name, *TextPath);
+		return false;
+	}
+
+	// The buffer is shared, so Resident.Text stays valid inside the map
+	ResidentLocales.Add(LocaleIndex, MoveTemp(Resident));
+
+	UE_LOG(LogGameScript, Log, TEXT("Locale %s is now resident (%s)"), *LocaleMetadata.Name, *TextPath);
+	return true;
+}
+
+TSharedRef<const FGSTextResolver, ESPMode::ThreadSafe> UGameScriptDatabase::CreateTextResolver() const
+{
+	check(IsInGameThread());
+
+	TSharedRef<FGSTextResolver, ESPMode::ThreadSafe> Resolver = MakeShared<FGSTextResolver, ESPMode::ThreadSafe>();
+	Resolver->Version = CurrentVersion;
+	Resolver->Structure = Snapshot;
+	Resolver->CurrentLocaleIndex = CurrentLocaleIndex;
+	if (!Snapshot)
+	{
+		return Resolver;
+	}
+
+	const UGameScriptManifest* ManifestPtr = Manifest.Get();
+
+	// Current locale: name from the loaded text, like UGameScriptRunner::ResolveText()
+	FGSTextResolver::FLocaleText& Current = Resolver->Locales.AddDefaulted_GetRef();
+	Current.LocaleIndex = CurrentLocaleIndex;
+	const GameScript::Snapshot* LocaleSnapshot = GetLocaleSnapshot();
+	Current.Text = LocaleSnapshot;
+	Current.Format = FGSLocaleFormat::Make(LocaleSnapshot->locale_name()
+		? FString(UTF8_TO_TCHAR(LocaleSnapshot->locale_name()->c_str())) : FString());
+	Current.FallbackChain = GetFallbackChain();
+	if (bIsStreaming)
+	{
+		// Resident entries only; the index entries have no variants
+		const int32 Count = LocalizationBlocks.Num();
+		Current.Streamed.SetNumZeroed(Count);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			Current.Streamed[i] = LocalizationBlocks[i] >= 0 ? StreamedLocalizations[i] : Snapshot->localizations()->Get(i);
+		}
+
+		// Keep the blocks those entries point into alive past eviction
+		for (const FStreamedBlock& Block : StreamedBlocks)
+		{
+			if (Block.Buffer.IsValid())
+			{
+				Resolver->ResidentBuffers.Add(Block.Buffer);
+			}
+		}
+	}
+
+	for (const TPair<int32, FResidentLocale>& Pair : ResidentLocales)
+	{
+		FGSTextResolver::FLocaleText& Resident = Resolver->Locales.AddDefaulted_GetRef();
+		Resident.LocaleIndex = Pair.Key;
+		Resident.Text = Pair.Value.Text;
+		Resolver->ResidentBuffers.Add(Pair.Value.Buffer);
+		Resident.Format = FGSLocaleFormat::Make(FLocaleRef(ManifestPtr, Pair.Key).GetCode());
+		if (ManifestPtr)
+		{
+			Resident.FallbackChain = ManifestPtr->GetFallbackChain(Pair.Key);
+		}
+	}
+
+	return Resolver;
+}
+
+void UGameScriptDatabase::RefreshFallbackLocales()
+{
+	const TArray<int32>& Chain = GetFallbackChain();
+
+	for (auto It = ResidentLocales.CreateIterator(); It; ++It)
+	{
+		if (!It->Value.bRequested && !Chain.Contains(It->Key))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (int32 LocaleIndex : Chain)
+	{
+		if (LocaleIndex != CurrentLocaleIndex && !ResidentLocales.Contains(LocaleIndex))
+		{
+			LoadResidentLocale(LocaleIndex, false);
+		}
+	}
+}
+
+// --- DRY: GetCount() methods use template helper ---
+
+int32 UGameScriptDatabase::GetNodeCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::nodes);
+}
+
+int32 UGameScriptDatabase::GetConversationCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::conversations);
+}
+
+int32 UGameScriptDatabase::GetActorCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::actors);
+}
+
+int32 UGameScriptDatabase::GetLocalizationCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::localizations);
+}
+
+int32 UGameScriptDatabase::GetEdgeCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::edges);
+}
+
+int32 UGameScriptDatabase::GetPropertyTemplateCount() const
+{
+	return GetCollectionCount(&GameScript::Snapshot::property_templates);
+}
+
+// --- DRY: FindEntity() methods use template helper ---
+
+FNodeRef UGameScriptDatabase::FindNode(int32 NodeId) const
+{
+	return FindEntityById<FNodeRef>(GetStructure().NodeIdToIndex, NodeId);
+}
+
+FConversationRef UGameScriptDatabase::FindConversation(int32 ConversationId) const
+{
+	return FindEntityById<FConversationRef>(GetStructure().ConversationIdToIndex, ConversationId);
+}
+
+FActorRef UGameScriptDatabase::FindActor(int32 ActorId) const
+{
+	return FindEntityById<FActorRef>(GetStructure().ActorIdToIndex, ActorId);
+}
+
+FLocalizationRef UGameScriptDatabase::FindLocalization(int32 LocalizationId) const
+{
+	return FindEntityById<FLocalizationRef>(GetStructure().LocalizationIdToIndex, LocalizationId);
+}
+
+FEdgeRef UGameScriptDatabase::FindEdge(int32 EdgeId) const
+{
+	return FindEntityById<FEdgeRef>(GetStructure().EdgeIdToIndex, EdgeId);
+}
+
+FPropertyTemplateRef UGameScriptDatabase::FindPropertyTemplate(int32 TemplateId) const
+{
+	return FindEntityById<FPropertyTemplateRef>(GetStructure().PropertyTemplateIdToIndex, TemplateId);
+}
+
+// --- Checked Lookups (log error if not found) ---
+
+FNodeRef UGameScriptDatabase::FindNodeChecked(int32 NodeId) const
+{
+	FNodeRef Ref = FindNode(NodeId);
+	if (!Ref.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("FindNodeChecked: Node with ID %d not found"), NodeId);
+	}
+	return Ref;
+}
+
+FConversationRef UGameScriptDatabase::FindConversationChecked(int32 ConversationId) const
+{
+	FConversationRef Ref = FindConversation(ConversationId);
+	if (!Ref.IsValid())
 	{
 		UE_LOG(LogGameScript, Error, TEXT("FindConversationChecked: Conversation with ID %d not found"), ConversationId);
 	}
 	return Ref;
 }
 
-FActorRef UGameScriptDatabase::FindActorChecked(int32 ActorId) const
+FActorRef UGameScriptDatabase::FindActorChecked(int32 ActorId) const
+{
+	FActorRef Ref = FindActor(ActorId);
+	if (!Ref.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("FindActorChecked: Actor with ID %d not found"), ActorId);
+	}
+	return Ref;
+}
+
+FLocalizationRef UGameScriptDatabase::FindLocalizationChecked(int32 LocalizationId) const
+{
+	FLocalizationRef Ref = FindLocalization(LocalizationId);
+	if (!Ref.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("FindLocalizationChecked: Localization with ID %d not found"), LocalizationId);
+	}
+	return Ref;
+}
+
+FEdgeRef UGameScriptDatabase::FindEdgeChecked(int32 EdgeId) const
+{
+	FEdgeRef Ref = FindEdge(EdgeId);
+	if (!Ref.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("FindEdgeChecked: Edge with ID %d not found"), EdgeId);
+	}
+	return Ref;
+}
+
+FPropertyTemplateRef UGameScriptDatabase::FindPropertyTemplateChecked(int32 TemplateId) const
+{
+	FPropertyTemplateRef Ref = FindPropertyTemplate(TemplateId);
+	if (!Ref.IsValid())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("FindPropertyTemplateChecked: PropertyTemplate with ID %d not found"), TemplateId);
+	}
+	return Ref;
+}
+
+// --- DRY: GetByIndex() methods use template helper ---
+
+FNodeRef UGameScriptDatabase::GetNodeByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FNodeRef>(Index, [this]() { return GetNodeCount(); });
+}
+
+FConversationRef UGameScriptDatabase::GetConversationByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FConversationRef>(Index, [this]() { return GetConversationCount(); });
+}
+
+FActorRef UGameScriptDatabase::GetActorByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FActorRef>(Index, [this]() { return GetActorCount(); });
+}
+
+FLocalizationRef UGameScriptDatabase::GetLocalizationByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FLocalizationRef>(Index, [this]() { return GetLocalizationCount(); });
+}
+
+FEdgeRef UGameScriptDatabase::GetEdgeByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FEdgeRef>(Index, [this]() { return GetEdgeCount(); });
+}
+
+FPropertyTemplateRef UGameScriptDatabase::GetPropertyTemplateByIndex(int32 Index) const
+{
+	return GetEntityByIndex<FPropertyTemplateRef>(Index, [this]() { return GetPropertyTemplateCount(); });
+}
+
+void UGameScriptDatabase::QueryConversations(const FGSTagQuery& Query, TArray<FConversationRef>& OutConversations) const
+{
+	TArray<int32> Indices;
+	GetStructure().ConversationTags.Query(Query, Indices);
+
+	OutConversations.Reset(Indices.Num());
+	for (int32 Index : Indices)
+	{
+		OutConversations.Add(FConversationRef(this, Index));
+	}
+}
+
+void UGameScriptDatabase::QueryLocalizations(const FGSTagQuery& Query, TArray<FLocalizationRef>& OutLocalizations) const
+{
+	TArray<int32> Indices;
+	GetStructure().LocalizationTags.Query(Query, Indices);
+
+	OutLocalizations.Reset(Indices.Num());
+	for (int32 Index : Indices)
+	{
+		OutLocalizations.Add(FLocalizationRef(this, Index));
+	}
+}
+
+TArray<FConversationRef> UGameScriptDatabase::FindConversationsByTags(const TMap<FString, FString>& Tags) const
+{
+	FGSTagQuery Query;
+	for (const TPair<FString, FString>& Tag : Tags)
+	{
+		Query.Where(Tag.Key, Tag.Value);
+	}
+
+	TArray<FConversationRef> Conversations;
+	QueryConversations(Query, Conversations);
+	return Conversations;
+}
+
+void UGameScriptDatabase::BuildTextSearchIndex()
+{
+	bKeepTextSearchIndex = true;
+	StartTextSearchBuild();
+}
+
+void UGameScriptDatabase::StartTextSearchBuild()
+{
+	if (!CurrentVersion || TextSearchBuildVersion == CurrentVersion->GetVersion())
+	{
+		return;
+	}
+
+	// The pin keeps the indexed text alive; a result for a version no longer current is dropped
+	FGSSnapshotPin Version = CurrentVersion;
+	TextSearchBuildVersion = Version->GetVersion();
+	TWeakObjectPtr<UGameScriptDatabase> WeakThis(this);
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Version]()
+	{
+		TSharedPtr<const FGSTextSearchIndex, ESPMode::ThreadSafe> Index =
+			MakeShared<const FGSTextSearchIndex, ESPMode::ThreadSafe>(*Version);
+
+		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, Index]()
+		{
+			UGameScriptDatabase* This = WeakThis.Get();
+			if (This && This->CurrentVersion && This->CurrentVersion->GetVersion() == Index->GetVersion())
+			{
+				This->TextSearchIndex = Index;
+			}
+		});
+	});
+}
+
+bool UGameScriptDatabase::SearchText(const FString& Query, TArray<FGSTextMatch>& OutMatches, int32 MaxResults, float MinScore) const
+{
+	if (!TextSearchIndex.IsValid())
+	{
+		OutMatches.Reset();
+		return false;
+	}
+
+	TextSearchIndex->Search(Query, OutMatches, MaxResults, MinScore);
+	return true;
+}
+
+TArray<FLocalizationRef> UGameScriptDatabase::SearchLocalizations(const FString& Query, int32 MaxResults) const
+{
+	TArray<FGSTextMatch> Matches;
+	SearchText(Query, Matches, MaxResults);
+
+	TArray<FLocalizationRef> Localizations;
+	Localizations.Reserve(Matches.Num());
+	for (const FGSTextMatch& Match : Matches)
+	{
+		Localizations.Add(FLocalizationRef(this, Match.LocalizationIndex));
+	}
+	return Localizations;
+}
+
+void UGameScriptDatabase::QueryNodes(const FGSPropertyQuery& Query, TArray<FNodeRef>& OutNodes) const
+{
+	OutNodes.Reset();
+	if (!Snapshot || Query.Filters.Num() == 0)
+	{
+		return;
+	}
+
+	// One slice of a column's node indices per filter; unknown properties match nothing
+	struct FFilterMatches
+	{
+		TConstArrayView<int32> Nodes;
+		bool bNodeOrder;
+	};
+	TArray<FFilterMatches> Matches;
+	Matches.Reserve(Query.Filters.Num());
+	for (const FGSPropertyQuery::FFilter& Filter : Query.Filters)
+	{
+		const int32* TemplateIndex = GetStructure().PropertyTemplateNameToIndex.Find(Filter.Property);
+		if (!TemplateIndex)
+		{
+			return;
+		}
+
+		// Slices point into the column, which PropertyColumns keeps alive for this call
+		TSharedPtr<const FGSPropertyColumn>& Column = PropertyColumns.FindOrAdd(*TemplateIndex);
+		if (!Column)
+		{
+			Column = MakeShared<const FGSPropertyColumn>(Snapshot, *TemplateIndex);
+		}
+		FFilterMatches& Match = Matches.AddDefaulted_GetRef();
+		Match.Nodes = Column->Evaluate(Filter, Match.bNodeOrder);
+		if (Match.Nodes.Num() == 0)
+		{
+			return;
+		}
+	}
+
+	// AND: filter the most selective slice by the others
+	Matches.Sort([](const FFilterMatches& A, const FFilterMatches& B) { return A.Nodes.Num() < B.Nodes.Num(); });
+	TArray<int32> Result(Matches[0].Nodes);
+	const bool bNodeOrder = Matches[0].bNodeOrder;
+	const int32 NodeCount = static_cast<int32>(Snapshot->nodes()->size());
+	TBitArray<> Members;
+	TArray<int32> Scratch;
+	for (int32 i = 1; i < Matches.Num() && Result.Num() > 0; ++i)
+	{
+		const FFilterMatches& Other = Matches[i];
+		if (!bNodeOrder || !Other.bNodeOrder)
+		{
+			// A range slice is in value order: test membership through a node bitmap
+			Members.Init(false, NodeCount);
+			for (int32 NodeIndex : Other.Nodes)
+			{
+				Members[NodeIndex] = true;
+			}
+			Result.RemoveAll([&Members](int32 NodeIndex) { return !Members[NodeIndex]; });
+			continue;
+		}
+
+		Scratch.Reset();
+		for (int32 A = 0, B = 0; A < Result.Num() && B < Other.Nodes.Num();)
+		{
+			if (Result[A] < Other.Nodes[B])
+			{
+				++A;
+			}
+			else if (Other.Nodes[B] < Result[A])
+			{
+				++B;
+			}
+			else
+			{
+				Scratch.Add(Result[A]);
+				++A;
+				++B;
+			}
+		}
+		Swap(Result, Scratch);
+	}
+
+	// Back to node order without a sort: mark the survivors and walk the bitmap
+	if (!bNodeOrder && Result.Num() > 1)
+	{
+		Members.Init(false, NodeCount);
+		for (int32 NodeIndex : Result)
+		{
+			Members[NodeIndex] = true;
+		}
+		Result.Reset();
+		for (TConstSetBitIterator<> It(Members); It; ++It)
+		{
+			Result.Add(It.GetIndex());
+		}
+	}
+
+	OutNodes.Reserve(Result.Num());
+	for (int32 NodeIndex : Result)
+	{
+		OutNodes.Add(FNodeRef(this, NodeIndex));
+	}
+}
+
+void UGameScriptDatabase::SetManifestAndBasePath(UGameScriptManifest* InManifest, const FString& InBasePath)
+{
+	Manifest = InManifest;
+	BasePath = InBasePath;
+}
+
+void UGameScriptDatabase::SetCurrentLocaleIndex(int32 InLocaleIndex)
+{
+	CurrentLocaleIndex = InLocaleIndex;
+	RefreshFallbackLocales();
+}
+
+// ---------------------------------------------------------------------------
+// Conversation Streaming
+// ---------------------------------------------------------------------------
+
+bool UGameScriptDatabase::LoadChunkedSnapshot(const FString& SnapshotPath)
+{
+	FSnapshotFiles Files;
+	if (!ReadChunkedSnapshot(SnapshotPath, Files))
+	{
+		return false;
+	}
+	CommitChunkedSnapshot(SnapshotPath, MoveTemp(Files));
+	return true;
+}
+
+bool UGameScriptDatabase::ReadChunkedSnapshot(const FString& SnapshotPath, FSnapshotFiles& OutFiles)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*SnapshotPath));
+	if (!Reader)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to open chunked snapshot: %s"), *SnapshotPath);
+		return false;
+	}
+
+	const int64 FileSize = Reader->TotalSize();
+
+	FGSChunkedHeader Header;
+	*Reader << Header;
+	if (Reader->IsError() || Header.Magic != GameScriptChunked::Magic || Header.Version != GameScriptChunked::Version)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Invalid chunked snapshot header (expected version %u): %s"),
+			GameScriptChunked::Version, *SnapshotPath);
+		return false;
+	}
+
+	// Both tables must fit in the file before their counts drive an allocation
+	const int64 TablesEnd = static_cast<int64>(sizeof(FGSChunkedHeader))
+		+ static_cast<int64>(Header.BlockCount) * sizeof(FGSChunkedBlockEntry)
+		+ static_cast<int64>(Header.LocalizationCount) * sizeof(int32);
+	if (TablesEnd > FileSize)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Chunked snapshot tables exceed the file (%u blocks, %u localizations): %s"),
+			Header.BlockCount, Header.LocalizationCount, *SnapshotPath);
+		return false;
+	}
+
+	// Block table and localization ownership table
+	TArray<FGSChunkedBlockEntry> Entries;
+	Entries.SetNum(Header.BlockCount);
+	for (FGSChunkedBlockEntry& Entry : Entries)
+	{
+		*Reader << Entry;
+	}
+
+	TArray<int32> TempLocalizationBlocks;
+	TempLocalizationBlocks.SetNumUninitialized(Header.LocalizationCount);
+	Reader->Serialize(TempLocalizationBlocks.GetData(), TempLocalizationBlocks.Num() * sizeof(int32));
+
+	// Bounds-check every region before trusting offsets
+	bool bLayoutValid = !Reader->IsError()
+		&& static_cast<int64>(Header.IndexOffset) + Header.IndexSize <= FileSize;
+	for (const FGSChunkedBlockEntry& Entry : Entries)
+	{
+		bLayoutValid &= static_cast<int64>(Entry.Offset) + Entry.Size <= FileSize;
+	}
+	for (int32 BlockIdx : TempLocalizationBlocks)
+	{
+		bLayoutValid &= BlockIdx >= -1 && BlockIdx < static_cast<int32>(Header.BlockCount);
+	}
+	if (!bLayoutValid)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Chunked snapshot layout is corrupt: %s"), *SnapshotPath);
+		return false;
+	}
+
+	// Load and verify the resident index
+	TArray<uint8> TempBuffer;
+	TempBuffer.SetNumUninitialized(Header.IndexSize);
+	Reader->Seek(Header.IndexOffset);
+	Reader->Serialize(TempBuffer.GetData(), TempBuffer.Num());
+	if (Reader->IsError())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to read chunked snapshot index: %s"), *SnapshotPath);
+		return false;
+	}
+
+	if (GameScriptCompressed::IsCompressed(TempBuffer))
+	{
+		TArray<uint8> RawBuffer;
+		if (!GameScriptCompressed::Decompress(TempBuffer, RawBuffer))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to decompress chunked snapshot index: %s"), *SnapshotPath);
+			return false;
+		}
+		TempBuffer = MoveTemp(RawBuffer);
+	}
+
+	flatbuffers::Verifier Verifier(TempBuffer.GetData(), TempBuffer.Num());
+	if (!GameScript::VerifySnapshotBuffer(Verifier))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Chunked snapshot index verification failed: %s"), *SnapshotPath);
+		return false;
+	}
+
+	const GameScript::Snapshot* TempSnapshot = GameScript::GetSnapshot(TempBuffer.GetData());
+	const int32 IndexLocalizationCount = TempSnapshot->localizations() ? TempSnapshot->localizations()->size() : 0;
+	if (IndexLocalizationCount != static_cast<int32>(Header.LocalizationCount))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Chunked snapshot localization table mismatch (%d vs %u): %s"),
+			IndexLocalizationCount, Header.LocalizationCount, *SnapshotPath);
+		return false;
+	}
+
+	OutFiles.Structure = MoveTemp(TempBuffer);
+	OutFiles.LocalizationBlocks = MoveTemp(TempLocalizationBlocks);
+	OutFiles.Blocks.SetNum(Entries.Num());
+	for (int32 i = 0; i < Entries.Num(); ++i)
+	{
+		FStreamedBlock& Block = OutFiles.Blocks[i];
+		Block.ConversationId = Entries[i].ConversationId;
+		Block.Offset = Entries[i].Offset;
+		Block.Size = Entries[i].Size;
+	}
+	return true;
+}
+
+void UGameScriptDatabase::CommitChunkedSnapshot(const FString& SnapshotPath, FSnapshotFiles&& Files)
+{
+	check(IsInGameThread());
+
+	// Verified while reading - commit (same path as LoadSnapshot)
+	CommitSnapshot(MoveTemp(Files.Structure), SnapshotPath);
+	bIsStreaming = true;
+	LocalizationBlocks = MoveTemp(Files.LocalizationBlocks);
+	StreamedLocalizations.SetNumZeroed(LocalizationBlocks.Num());
+	StreamedBlocks = MoveTemp(Files.Blocks);
+	for (int32 i = 0; i < StreamedBlocks.Num(); ++i)
+	{
+		ConversationIdToBlock.Add(StreamedBlocks[i].ConversationId, i);
+	}
+
+	if (StreamingBudgetBytes < 0)
+	{
+		const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+		StreamingBudgetBytes = static_cast<int64>(Settings->StreamingBudgetKB) * 1024;
+	}
+
+	// Conversations that were running before a reload keep their text resident
+	for (const TPair<int32, int32>& Pin : ConversationPins)
+	{
+		if (const int32* BlockIdx = ConversationIdToBlock.Find(Pin.Key))
+		{
+			LoadStreamedBlock(*BlockIdx);
+		}
+	}
+
+	UE_LOG(LogGameScript, Log, TEXT("Loaded chunked snapshot %s (index %d bytes, %d streamed blocks)"),
+		*SnapshotPath, GetStructure().Buffer.Num(), StreamedBlocks.Num());
+}
+
+void UGameScriptDatabase::ResetStreamingState()
+{
+	// Pins are intentionally kept - they describe running conversations, not loaded data
+	bIsStreaming = false;
+	StreamedBlocks.Empty();
+	StreamedLocalizations.Empty();
+	LocalizationBlocks.Empty();
+	ConversationIdToBlock.Empty();
+	StreamingResidentBytes = 0;
+	++StreamingGeneration;
+}
+
+const GameScript::Localization* UGameScriptDatabase::GetLocalizationText(int32 LocalizationIdx) const
+{
+	if (!Snapshot || !Snapshot->localizations()
+		|| LocalizationIdx < 0 || LocalizationIdx >= static_cast<int32>(Snapshot->localizations()->size()))
+	{
+		return nullptr;
+	}
+
+	if (bIsStreaming)
+	{
+		const int32 BlockIdx = LocalizationBlocks[LocalizationIdx];
+		if (BlockIdx >= 0)
+		{
+			// Fault the block in on demand (game thread only - block commits are not synchronized)
+			if (StreamedLocalizations[LocalizationIdx] || (IsInGameThread() && LoadStreamedBlock(BlockIdx)))
+			{
+				StreamedBlocks[BlockIdx].LastUseTick = ++StreamingTick;
+				return StreamedLocalizations[LocalizationIdx];
+			}
+		}
+	}
+
+	// Split layout: text lives in the locale's string table, aligned by index
+	const GameScript::Snapshot* TextSource = StringTable ? StringTable : Snapshot;
+	return TextSource->localizations()->Get(LocalizationIdx);
+}
+
+const GameScript::Localization* UGameScriptDatabase::GetLocalizationText(int32 LocalizationIdx, int32 LocaleIndex) const
+{
+	if (LocaleIndex == INDEX_NONE || LocaleIndex == CurrentLocaleIndex)
+	{
+		return GetLocalizationText(LocalizationIdx);
+	}
+
+	// Resident text is validated against the structure on load, so the index is shared
+	const FResidentLocale* Resident = ResidentLocales.Find(LocaleIndex);
+	if (!Resident || !Snapshot || !Snapshot->localizations()
+		|| LocalizationIdx < 0 || LocalizationIdx >= static_cast<int32>(Snapshot->localizations()->size()))
+	{
+		return nullptr;
+	}
+	return Resident->Text->localizations()->Get(LocalizationIdx);
+}
+
+bool UGameScriptDatabase::PrefetchConversation(int32 ConversationId)
+{
+	check(IsInGameThread());
+
+	if (!GetStructure().ConversationIdToIndex.Contains(ConversationId))
+	{
+		return false;
+	}
+
+	const int32* BlockIdxPtr = ConversationIdToBlock.Find(ConversationId);
+	if (!bIsStreaming || !BlockIdxPtr)
+	{
+		// Nothing to stream - all of this conversation's text is resident
+		return true;
+	}
+
+	const int32 BlockIdx = *BlockIdxPtr;
+	FStreamedBlock& Block = StreamedBlocks[BlockIdx];
+	if (Block.Buffer.IsValid() || Block.bPending)
+	{
+		Block.LastUseTick = ++StreamingTick;
+		return true;
+	}
+
+	Block.bPending = true;
+
+	// Read off the game thread, commit back on it
+	TWeakObjectPtr<UGameScriptDatabase> WeakThis(this);
+	const FString Path = CurrentSnapshotPath;
+	const uint32 Offset = Block.Offset;
+	const uint32 Size = Block.Size;
+	const uint32 Generation = StreamingGeneration;
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Path, Offset, Size, BlockIdx, Generation]()
+	{
+		TArray<uint8> Buffer;
+		const bool bRead = ReadStreamedBlock(Path, Offset, Size, Buffer);
+
+		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, BlockIdx, Generation, bRead, Buffer = MoveTemp(Buffer)]() mutable
+		{
+			UGameScriptDatabase* This = WeakThis.Get();
+			if (!This || This->StreamingGeneration != Generation)
+			{
+				// Database was destroyed or reloaded while reading
+				return;
+			}
+
+			This->StreamedBlocks[BlockIdx].bPending = false;
+			if (bRead)
+			{
+				This->CommitStreamedBlock(BlockIdx, MoveTemp(Buffer));
+			}
+		});
+	});
+
+	return true;
+}
+
+bool UGameScriptDatabase::IsConversationResident(int32 ConversationId) const
 {
-	FActorRef Ref = FindActor(ActorId);
-	if (!Ref.IsValid())
+	if (!GetStructure().ConversationIdToIndex.Contains(ConversationId))
 	{
-		UE_LOG(LogGameScript, Error, TEXT("FindActorChecked: Actor with ID %d not found"), ActorId);
+		return false;
 	}
-	return Ref;
+
+	const int32* BlockIdx = ConversationIdToBlock.Find(ConversationId);
+	return !BlockIdx || StreamedBlocks[*BlockIdx].Buffer.IsValid();
 }
 
-FLocalizationRef UGameScriptDatabase::FindLocalizationChecked(int32 LocalizationId) const
+void UGameScriptDatabase::PinConversation(int32 ConversationId)
 {
-	FLocalizationRef Ref = FindLocalization(LocalizationId);
-	if (!Ref.IsValid())
+	check(IsInGameThread());
+
+	ConversationPins.FindOrAdd(ConversationId)++;
+
+	if (const int32* BlockIdx = ConversationIdToBlock.Find(ConversationId))
 	{
-		UE_LOG(LogGameScript, Error, TEXT("FindLocalizationChecked: Localization with ID %d not found"), LocalizationId);
+		LoadStreamedBlock(*BlockIdx);
 	}
-	return Ref;
 }
 
-FEdgeRef UGameScriptDatabase::FindEdgeChecked(int32 EdgeId) const
+void UGameScriptDatabase::UnpinConversation(int32 ConversationId)
 {
-	FEdgeRef Ref = FindEdge(EdgeId);
-	if (!Ref.IsValid())
+	check(IsInGameThread());
+
+	int32* PinCount = ConversationPins.Find(ConversationId);
+	if (!PinCount)
 	{
-		UE_LOG(LogGameScript, Error, TEXT("FindEdgeChecked: Edge with ID %d not found"), EdgeId);
+		return;
 	}
-	return Ref;
-}
 
-FPropertyTemplateRef UGameScriptDatabase::FindPropertyTemplateChecked(int32 TemplateId) const
-{
-	FPropertyTemplateRef Ref = FindPropertyTemplate(TemplateId);
-	if (!Ref.IsValid())
+	if (--(*PinCount) <= 0)
 	{
-		UE_LOG(LogGameScript, Error, TEXT("FindPropertyTemplateChecked: PropertyTemplate with ID %d not found"), TemplateId);
+		ConversationPins.Remove(ConversationId);
+
+		// The block is now evictable - trim if a pinned phase pushed us over budget
+		EnforceStreamingBudget();
 	}
-	return Ref;
 }
 
-// --- DRY: GetByIndex() methods use template helper ---
-
-FNodeRef UGameScriptDatabase::GetNodeByIndex(int32 Index) const
+void UGameScriptDatabase::SetStreamingBudget(int64 InBudgetBytes)
 {
-	return GetEntityByIndex<FNodeRef>(Index, [this]() { return GetNodeCount(); });
+	StreamingBudgetBytes = FMath::Max<int64>(InBudgetBytes, 0);
+	EnforceStreamingBudget();
 }
 
-FConversationRef UGameScriptDatabase::GetConversationByIndex(int32 Index) const
+bool UGameScriptDatabase::LoadStreamedBlock(int32 BlockIdx) const
 {
-	return GetEntityByIndex<FConversationRef>(Index, [this]() { return GetConversationCount(); });
-}
+	FStreamedBlock& Block = StreamedBlocks[BlockIdx];
+	if (Block.Buffer.IsValid())
+	{
+		Block.LastUseTick = ++StreamingTick;
+		return true;
+	}
 
-FActorRef UGameScriptDatabase::GetActorByIndex(int32 Index) const
-{
-	return GetEntityByIndex<FActorRef>(Index, [this]() { return GetActorCount(); });
-}
+	// A pending prefetch may still be in flight; loading synchronously here is fine,
+	// the late result is discarded by CommitStreamedBlock()
+	TArray<uint8> Buffer;
+	if (!ReadStreamedBlock(CurrentSnapshotPath, Block.Offset, Block.Size, Buffer))
+	{
+		return false;
+	}
 
-FLocalizationRef UGameScriptDatabase::GetLocalizationByIndex(int32 Index) const
-{
-	return GetEntityByIndex<FLocalizationRef>(Index, [this]() { return GetLocalizationCount(); });
+	CommitStreamedBlock(BlockIdx, MoveTemp(Buffer));
+	return true;
 }
 
-FEdgeRef UGameScriptDatabase::GetEdgeByIndex(int32 Index) const
+void UGameScriptDatabase::CommitStreamedBlock(int32 BlockIdx, TArray<uint8>&& Buffer) const
 {
-	return GetEntityByIndex<FEdgeRef>(Index, [this]() { return GetEdgeCount(); });
-}
+	FStreamedBlock& Block = StreamedBlocks[BlockIdx];
+	if (Block.Buffer.IsValid())
+	{
+		return;
+	}
 
-FPropertyTemplateRef UGameScriptDatabase::GetPropertyTemplateByIndex(int32 Index) const
-{
-	return GetEntityByIndex<FPropertyTemplateRef>(Index, [this]() { return GetPropertyTemplateCount(); });
+	Block.Buffer = MakeShared<const TArray<uint8>, ESPMode::ThreadSafe>(MoveTemp(Buffer));
+	Block.LastUseTick = ++StreamingTick;
+	StreamingResidentBytes += Block.Buffer->Num();
+
+	// Point each owned localization at its streamed entry
+	const TMap<int32, int32>& LocalizationIdToIndex = GetStructure().LocalizationIdToIndex;
+	const GameScript::Snapshot* BlockSnapshot = GameScript::GetSnapshot(Block.Buffer->GetData());
+	if (const auto* Localizations = BlockSnapshot->localizations())
+	{
+		for (const GameScript::Localization* Loc : *Localizations)
+		{
+			if (const int32* LocIdx = LocalizationIdToIndex.Find(Loc->id()))
+			{
+				StreamedLocalizations[*LocIdx] = Loc;
+			}
+		}
+	}
+
+	// The block was just asked for: evicting it here would fail the read that faulted it in
+	EnforceStreamingBudget(BlockIdx);
 }
 
-void UGameScriptDatabase::BuildIdMaps()
+void UGameScriptDatabase::EvictStreamedBlock(int32 BlockIdx) const
 {
-	// Clear all maps first (critical for locale switching - prevents stale entries)
-	NodeIdToIndex.Empty();
-	ConversationIdToIndex.Empty();
-	ActorIdToIndex.Empty();
-	LocalizationIdToIndex.Empty();
-	EdgeIdToIndex.Empty();
-	PropertyTemplateIdToIndex.Empty();
+	OnSnapshotMemoryReleasing.Broadcast();
 
-	if (!Snapshot)
+	FStreamedBlock& Block = StreamedBlocks[BlockIdx];
+
+	const TMap<int32, int32>& LocalizationIdToIndex = GetStructure().LocalizationIdToIndex;
+	const GameScript::Snapshot* BlockSnapshot = GameScript::GetSnapshot(Block.Buffer->GetData());
+	if (const auto* Localizations = BlockSnapshot->localizations())
 	{
-		return;
+		for (const GameScript::Localization* Loc : *Localizations)
+		{
+			if (const int32* LocIdx = LocalizationIdToIndex.Find(Loc->id()))
+			{
+				StreamedLocalizations[*LocIdx] = nullptr;
+			}
+		}
 	}
 
-	// Helper lambda to build ID maps (eliminates code duplication)
-	auto BuildIdMap = [](const auto* Entities, TMap<int32, int32>& OutMap)
+	// Text resolvers created while the block was resident keep their own reference
+	StreamingResidentBytes -= Block.Buffer->Num();
+	Block.Buffer.Reset();
+}
+
+void UGameScriptDatabase::EnforceStreamingBudget(int32 KeepBlockIdx) const
+{
+	// Evict least-recently-used unpinned blocks until under budget.
+	// Linear scan per eviction: block count equals conversation count, and evictions are rare.
+	while (StreamingResidentBytes > StreamingBudgetBytes)
 	{
-		if (!Entities)
+		int32 VictimIdx = INDEX_NONE;
+		uint64 OldestTick = MAX_uint64;
+		for (int32 i = 0; i < StreamedBlocks.Num(); ++i)
 		{
-			return;
+			const FStreamedBlock& Block = StreamedBlocks[i];
+			if (i != KeepBlockIdx && Block.Buffer.IsValid() && Block.LastUseTick < OldestTick && !ConversationPins.Contains(Block.ConversationId))
+			{
+				VictimIdx = i;
+				OldestTick = Block.LastUseTick;
+			}
 		}
-		OutMap.Reserve(Entities->size());
-		for (int32 i = 0; i < static_cast<int32>(Entities->size()); ++i)
+
+		if (VictimIdx == INDEX_NONE)
 		{
-			OutMap.Add(Entities->Get(i)->id(), i);
+			// Everything resident is pinned by a running conversation or just committed
+			break;
 		}
-	};
 
-	// Build all ID to index maps
-	BuildIdMap(Snapshot->nodes(), NodeIdToIndex);
-	BuildIdMap(Snapshot->conversations(), ConversationIdToIndex);
-	BuildIdMap(Snapshot->actors(), ActorIdToIndex);
-	BuildIdMap(Snapshot->localizations(), LocalizationIdToIndex);
-	BuildIdMap(Snapshot->edges(), EdgeIdToIndex);
-	BuildIdMap(Snapshot->property_templates(), PropertyTemplateIdToIndex);
+		EvictStreamedBlock(VictimIdx);
+	}
 }
 
-void UGameScriptDatabase::SetManifestAndBasePath(UGameScriptManifest* InManifest, const FString& InBasePath)
+bool UGameScriptDatabase::ReadStreamedBlock(const FString& Path, uint32 Offset, uint32 Size, TArray<uint8>& OutBuffer)
 {
-	Manifest = InManifest;
-	BasePath = InBasePath;
-}
+	// Own reader per call: safe from both the game thread and prefetch workers
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to open chunked snapshot for streaming: %s"), *Path);
+		return false;
+	}
 
-void UGameScriptDatabase::SetCurrentLocaleIndex(int32 InLocaleIndex)
-{
-	CurrentLocaleIndex = InLocaleIndex;
+	OutBuffer.SetNumUninitialized(Size);
+	Reader->Seek(Offset);
+	Reader->Serialize(OutBuffer.GetData(), Size);
+	if (Reader->IsError())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to read streamed block at offset %u: %s"), Offset, *Path);
+		return false;
+	}
+
+	// Blocks are compressed individually - decompress only the one being streamed in
+	if (GameScriptCompressed::IsCompressed(OutBuffer))
+	{
+		TArray<uint8> RawBuffer;
+		if (!GameScriptCompressed::Decompress(OutBuffer, RawBuffer))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to decompress streamed block at offset %u: %s"), Offset, *Path);
+			return false;
+		}
+		OutBuffer = MoveTemp(RawBuffer);
+	}
+
+	flatbuffers::Verifier Verifier(OutBuffer.GetData(), OutBuffer.Num());
+	if (!GameScript::VerifySnapshotBuffer(Verifier))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Streamed block verification failed at offset %u: %s"), Offset, *Path);
+		return false;
+	}
+
+	return true;
 }
 
 #if WITH_EDITOR
@@ -349,6 +1790,9 @@ FString UGameScriptDatabase::EditorBasePath;
 FString UGameScriptDatabase::EditorLoadedHash;
 int32 UGameScriptDatabase::EditorLoadedLocaleId = -1;
 UGameScriptManifest* UGameScriptDatabase::EditorManifest = nullptr;
+FSimpleMulticastDelegate UGameScriptDatabase::OnEditorDataReloaded;
+FTSTicker::FDelegateHandle UGameScriptDatabase::EditorReloadTicker;
+uint32 UGameScriptDatabase::EditorReloadGeneration = 0;
 
 void UGameScriptDatabase::EnsureEditorInstance()
 {
@@ -457,16 +1901,25 @@ void UGameScriptDatabase::EnsureEditorInstance()
 			UGameScriptDatabase* Database = EditorManifest->LoadDatabase(EditorLocale);
 			if (Database)
 			{
-				// Move the loaded database state to EditorInstance (transfer ownership)
-				// Using MoveTemp for efficient transfer without deep copying
-				EditorInstance->Snapshot = Database->Snapshot;
-				EditorInstance->SnapshotBuffer = MoveTemp(Database->SnapshotBuffer);
+				// The version below may still be under background verification
+				Database->WaitForBackgroundVerification();
+
+				// Share the loaded version (snapshot, string table, ID maps) with EditorInstance
+				// and move the remaining database state over (transfer ownership)
+				EditorInstance->OnSnapshotMemoryReleasing.Broadcast();
+				EditorInstance->PublishVersion(Database->CurrentVersion);
+				EditorInstance->CurrentStructurePath = MoveTemp(Database->CurrentStructurePath);
 				EditorInstance->CurrentSnapshotPath = MoveTemp(Database->CurrentSnapshotPath);
-				EditorInstance->NodeIdToIndex = MoveTemp(Database->NodeIdToIndex);
-				EditorInstance->ConversationIdToIndex = MoveTemp(Database->ConversationIdToIndex);
-				EditorInstance->ActorIdToIndex = MoveTemp(Database->ActorIdToIndex);
-				EditorInstance->LocalizationIdToIndex = MoveTemp(Database->LocalizationIdToIndex);
-				EditorInstance->EdgeIdToIndex = MoveTemp(Database->EdgeIdToIndex);
+
+				// Streaming state (populated only when a chunked snapshot was loaded)
+				EditorInstance->bIsStreaming = Database->bIsStreaming;
+				EditorInstance->StreamedBlocks = MoveTemp(Database->StreamedBlocks);
+				EditorInstance->StreamedLocalizations = MoveTemp(Database->StreamedLocalizations);
+				EditorInstance->LocalizationBlocks = MoveTemp(Database->LocalizationBlocks);
+				EditorInstance->ConversationIdToBlock = MoveTemp(Database->ConversationIdToBlock);
+				EditorInstance->StreamingResidentBytes = Database->StreamingResidentBytes;
+				EditorInstance->StreamingBudgetBytes = Database->StreamingBudgetBytes;
+				++EditorInstance->StreamingGeneration;
 
 				// Store manifest reference in EditorInstance for locale operations
 				EditorInstance->SetManifestAndBasePath(EditorManifest, EditorBasePath);
@@ -526,6 +1979,9 @@ void UGameScriptDatabase::CheckForHotReload()
 			EditorManifest = nullptr;
 		}
 
+		// Supersede any coalesced or in-flight EditorReload so it cannot publish over this one
+		++EditorReloadGeneration;
+
 		// Reload by clearing current state and triggering re-initialization
 		EditorInstance->CurrentSnapshotPath.Empty();
 		EditorLoadedHash.Empty();
@@ -533,6 +1989,96 @@ void UGameScriptDatabase::CheckForHotReload()
 	}
 }
 
+void UGameScriptDatabase::EditorRequestReload()
+{
+	check(IsInGameThread());
+
+	// Restart the delay on every request so the reload follows the last write of a burst
+	if (EditorReloadTicker.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(EditorReloadTicker);
+	}
+	EditorReloadTicker = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float)
+	{
+		EditorReloadTicker.Reset();
+		EditorReload();
+		return false;
+	}), EditorReloadDelay);
+}
+
+void UGameScriptDatabase::EditorReload()
+{
+	const uint32 Generation = ++EditorReloadGeneration;
+
+	// Nothing loaded yet, or split and streaming layouts (several files): reload in place
+	if (!EditorInstance || EditorInstance->CurrentSnapshotPath.IsEmpty() || EditorInstance->StringTable || EditorInstance->bIsStreaming)
+	{
+		EditorReloadInPlace();
+		return;
+	}
+
+	// Read, decompress and verify on a worker thread; swap on the game thread
+	const FString Path = EditorInstance->CurrentSnapshotPath;
+	Async(EAsyncExecution::ThreadPool, [Path, Generation]()
+	{
+		TArray<uint8> Buffer;
+		const bool bRead = ReadSnapshotFile(Path, Buffer);
+
+		Async(EAsyncExecution::TaskGraphMainThread, [Path, Generation, bRead, Buffer = MoveTemp(Buffer)]() mutable
+		{
+			if (Generation != EditorReloadGeneration || !EditorInstance || EditorInstance->CurrentSnapshotPath != Path)
+			{
+				// Superseded by a later reload, or the editor instance was reset
+				return;
+			}
+			if (!bRead)
+			{
+				UE_LOG(LogGameScript, Warning, TEXT("Editor reload skipped - keeping the loaded snapshot until %s changes again"), *Path);
+				return;
+			}
+
+			// A re-export may add locales or move the editor locale's snapshot; reload the manifest too
+			UGameScriptManifest* NewManifest = UGameScriptLoader::LoadManifest(EditorBasePath);
+			const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+			const int32 LocaleIndex = NewManifest && Settings->EditorLocaleIndex >= 0 && Settings->EditorLocaleIndex < NewManifest->GetLocaleCount()
+				? Settings->EditorLocaleIndex
+				: (NewManifest ? NewManifest->GetPrimaryLocale().Index : INDEX_NONE);
+			if (!NewManifest || NewManifest->GetSnapshotPath(LocaleIndex) != Path)
+			{
+				EditorReloadInPlace();
+				return;
+			}
+
+			if (EditorManifest)
+			{
+				EditorManifest->RemoveFromRoot();
+			}
+			EditorManifest = NewManifest;
+			EditorManifest->AddToRoot();
+			EditorInstance->SetManifestAndBasePath(EditorManifest, EditorBasePath);
+			EditorInstance->CommitSnapshot(MoveTemp(Buffer), Path);
+
+			const FString ManifestPath = FPaths::Combine(EditorBasePath, TEXT("manifest.json"));
+			EditorLoadedHash = IFileManager::Get().GetTimeStamp(*ManifestPath).ToString();
+
+			UE_LOG(LogGameScript, Log, TEXT("Editor reloaded %s"), *Path);
+			OnEditorDataReloaded.Broadcast();
+		});
+	});
+}
+
+void UGameScriptDatabase::EditorReloadInPlace()
+{
+	if (EditorInstance)
+	{
+		EditorInstance->CurrentSnapshotPath.Empty();
+	}
+	EditorLoadedHash.Empty();
+	EnsureEditorInstance();
+
+	OnEditorDataReloaded.Broadcast();
+}
+
 FString UGameScriptDatabase::EditorGetConversationName(int32 ConversationId)
 {
 	EnsureEditorInstance();
@@ -705,4 +2251,214 @@ bool UGameScriptDatabase::EditorGetAllLocales(TArray<int32>& OutIds, TArray<FStr
 
 	return OutIds.Num() > 0;
 }
+bool UGameScriptDatabase::EditorPackChunkedSnapshots()
+{
+	EnsureEditorInstance();
+
+	if (!EditorManifest)
+	{
+		UE_LOG(LogGameScript, Warning, TEXT("Cannot pack chunked snapshots - no manifest found under the GameScript data path"));
+		return false;
+	}
+
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+
+	bool bAllPacked = true;
+	for (int32 i = 0; i < EditorManifest->GetLocaleCount(); ++i)
+	{
+		const FManifestLocale& Locale = EditorManifest->GetLocaleMetadata(i);
+		FString SourcePath = FPaths::Combine(EditorBasePath, TEXT("locales"), Locale.Name + TEXT(".gsb"));
+		FString TargetPath = FPaths::ChangeExtension(SourcePath, GameScriptChunked::Extension());
+
+		TArray<uint8> SourceData;
+		if (!FFileHelper::LoadFileToArray(SourceData, *SourcePath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshot file: %s"), *SourcePath);
+			bAllPacked = false;
+			continue;
+		}
+
+		TArray<uint8> PackedData;
+		int32 BlockCount = 0;
+		if (!GameScriptChunked::Pack(SourceData, PackedData, BlockCount, Settings->SnapshotCompressionFormat))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to pack snapshot: %s"), *SourcePath);
+			bAllPacked = false;
+			continue;
+		}
+
+		if (!FFileHelper::SaveArrayToFile(PackedData, *TargetPath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to write chunked snapshot: %s"), *TargetPath);
+			bAllPacked = false;
+			continue;
+		}
+
+		UE_LOG(LogGameScript, Log, TEXT("Packed %s (%d bytes) into %s (%d bytes, %d conversation blocks)"),
+			*SourcePath, SourceData.Num(), *TargetPath, PackedData.Num(), BlockCount);
+	}
+
+	return bAllPacked;
+}
+
+bool UGameScriptDatabase::EditorCompressSnapshots()
+{
+	EnsureEditorInstance();
+
+	if (!EditorManifest)
+	{
+		UE_LOG(LogGameScript, Warning, TEXT("Cannot compress snapshots - no manifest found under the GameScript data path"));
+		return false;
+	}
+
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+	const FName Format = Settings->SnapshotCompressionFormat.IsNone() ? NAME_Zlib : Settings->SnapshotCompressionFormat;
+
+	bool bAllCompressed = true;
+	for (int32 i = 0; i < EditorManifest->GetLocaleCount(); ++i)
+	{
+		const FManifestLocale& Locale = EditorManifest->GetLocaleMetadata(i);
+		FString SourcePath = FPaths::Combine(EditorBasePath, TEXT("locales"), Locale.Name + TEXT(".gsb"));
+		FString TargetPath = FPaths::ChangeExtension(SourcePath, GameScriptCompressed::Extension());
+
+		TArray<uint8> SourceData;
+		if (!FFileHelper::LoadFileToArray(SourceData, *SourcePath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshot file: %s"), *SourcePath);
+			bAllCompressed = false;
+			continue;
+		}
+
+		TArray<uint8> CompressedData;
+		if (!GameScriptCompressed::Compress(SourceData, CompressedData, Format)
+			|| !FFileHelper::SaveArrayToFile(CompressedData, *TargetPath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to write compressed snapshot: %s"), *TargetPath);
+			bAllCompressed = false;
+			continue;
+		}
+
+		UE_LOG(LogGameScript, Log, TEXT("Compressed %s (%d bytes) into %s (%d bytes, %s)"),
+			*SourcePath, SourceData.Num(), *TargetPath, CompressedData.Num(), *Format.ToString());
+	}
+
+	return bAllCompressed;
+}
+
+bool UGameScriptDatabase::EditorSplitSnapshots()
+{
+	EnsureEditorInstance();
+
+	if (!EditorManifest)
+	{
+		UE_LOG(LogGameScript, Warning, TEXT("Cannot split snapshots - no manifest found under the GameScript data path"));
+		return false;
+	}
+
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+	const FName Format = Settings->SnapshotCompressionFormat;
+
+	// Wrap in a compressed container when a codec is configured
+	auto SaveSplitFile = [&Format](TArray<uint8>& Data, const FString& Path)
+	{
+		if (!Format.IsNone())
+		{
+			TArray<uint8> Compressed;
+			if (!GameScriptCompressed::Compress(Data, Compressed, Format))
+			{
+				return false;
+			}
+			Data = MoveTemp(Compressed);
+		}
+		return FFileHelper::SaveArrayToFile(Data, *Path);
+	};
+
+	TArray<uint8> SharedStructure;
+	FString StructureSourcePath;
+	for (int32 i = 0; i < EditorManifest->GetLocaleCount(); ++i)
+	{
+		const FManifestLocale& Locale = EditorManifest->GetLocaleMetadata(i);
+		FString SourcePath = FPaths::Combine(EditorBasePath, TEXT("locales"), Locale.Name + TEXT(".gsb"));
+		FString TargetPath = FPaths::ChangeExtension(SourcePath, GameScriptSplit::StringTableExtension());
+
+		TArray<uint8> SourceData;
+		if (!FFileHelper::LoadFileToArray(SourceData, *SourcePath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshot file: %s"), *SourcePath);
+			return false;
+		}
+
+		TArray<uint8> Structure;
+		TArray<uint8> StringTable;
+		if (!GameScriptSplit::Split(SourceData, Structure, StringTable))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to split snapshot: %s"), *SourcePath);
+			return false;
+		}
+
+		// Every locale must share one structure, otherwise string tables would not line up
+		if (SharedStructure.Num() == 0)
+		{
+			SharedStructure = MoveTemp(Structure);
+			StructureSourcePath = SourcePath;
+		}
+		else if (Structure != SharedStructure)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Snapshot structure of %s differs from %s - re-export all locales together"),
+				*SourcePath, *StructureSourcePath);
+			return false;
+		}
+
+		const int32 TableSize = StringTable.Num();
+		if (!SaveSplitFile(StringTable, TargetPath))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to write string table: %s"), *TargetPath);
+			return false;
+		}
+
+		UE_LOG(LogGameScript, Log, TEXT("Split %s (%d bytes) into string table %s (%d bytes, %d on disk)"),
+			*SourcePath, SourceData.Num(), *TargetPath, TableSize, StringTable.Num());
+	}
+
+	if (SharedStructure.Num() == 0)
+	{
+		return false;
+	}
+
+	// Written last so a failed split never leaves a structure without its string tables
+	const FString StructurePath = GameScriptSplit::GetStructurePath(EditorBasePath);
+	const int32 StructureSize = SharedStructure.Num();
+	if (!SaveSplitFile(SharedStructure, StructurePath))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to write snapshot structure: %s"), *StructurePath);
+		return false;
+	}
+
+	UE_LOG(LogGameScript, Log, TEXT("Wrote shared structure %s (%d bytes, %d on disk) for %d locales"),
+		*StructurePath, StructureSize, SharedStructure.Num(), EditorManifest->GetLocaleCount());
+	return true;
+}
+
+bool UGameScriptDatabase::EditorCreateSnapshotPatch(const FString& BaseSnapshotPath, const FString& TargetSnapshotPath, const FString& PatchPath)
+{
+	TArray<uint8> BaseData;
+	TArray<uint8> TargetData;
+	if (!FFileHelper::LoadFileToArray(BaseData, *BaseSnapshotPath) || !FFileHelper::LoadFileToArray(TargetData, *TargetSnapshotPath))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to read snapshots for patch: %s -> %s"), *BaseSnapshotPath, *TargetSnapshotPath);
+		return false;
+	}
+
+	TArray<uint8> PatchData;
+	GameScriptPatch::Create(BaseData, TargetData, PatchData);
+	if (!FFileHelper::SaveArrayToFile(PatchData, *PatchPath))
+	{
+		UE_LOG(LogGameScript, Error, TEXT("Failed to write snapshot patch: %s"), *PatchPath);
+		return false;
+	}
+
+	UE_LOG(LogGameScript, Log, TEXT("Created snapshot patch %s (%d bytes for a %d byte snapshot)"),
+		*PatchPath, PatchData.Num(), TargetData.Num());
+	return true;
+}
 #endif
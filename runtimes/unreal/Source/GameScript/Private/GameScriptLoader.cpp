@@ -88,6 +88,7 @@ bool UGameScriptLoader::ParseManifest(
 		Locale.Name = LocaleObj->GetStringField(TEXT("name"));
 		Locale.LocalizedName = LocaleObj->GetStringField(TEXT("localizedName"));
 		Locale.Hash = LocaleObj->GetStringField(TEXT("hash"));
+		LocaleObj->TryGetStringField(TEXT("fallback"), Locale.Fallback);
 
 		OutLocales.Add(Locale);
 	}
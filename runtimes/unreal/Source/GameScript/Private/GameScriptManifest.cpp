@@ -3,6 +3,10 @@
 #include "GameScriptRunner.h"
 #include "GameScriptSettings.h"
 #include "GameScript.h"
+#include "ChunkedSnapshot.h"
+#include "CompressedSnapshot.h"
+#include "SplitSnapshot.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 
 void UGameScriptManifest::Initialize(
@@ -13,6 +17,31 @@ void UGameScriptManifest::Initialize(
 	BasePath = InBasePath;
 	Locales = InLocales;
 	PrimaryLocaleIndex = InPrimaryLocaleIndex;
+
+	// Resolve fallback names to indices once; chains stop at unknown names and cycles
+	FallbackChains.SetNum(Locales.Num());
+	for (int32 i = 0; i < Locales.Num(); ++i)
+	{
+		TArray<int32>& Chain = FallbackChains[i];
+		Chain.Reset();
+		FString Next = Locales[i].Fallback;
+		while (!Next.IsEmpty())
+		{
+			const int32 NextIndex = Locales.IndexOfByPredicate([&Next](const FManifestLocale& Locale) { return Locale.Name == Next; });
+			if (NextIndex == INDEX_NONE)
+			{
+				UE_LOG(LogGameScript, Warning, TEXT("Locale %s falls back to unknown locale %s"), *Locales[i].Name, *Next);
+				break;
+			}
+			if (NextIndex == i || Chain.Contains(NextIndex))
+			{
+				UE_LOG(LogGameScript, Warning, TEXT("Fallback chain for locale %s contains a cycle at %s"), *Locales[i].Name, *Next);
+				break;
+			}
+			Chain.Add(NextIndex);
+			Next = Locales[NextIndex].Fallback;
+		}
+	}
 }
 
 const FManifestLocale& UGameScriptManifest::GetLocaleMetadata(int32 Index) const
@@ -25,6 +54,63 @@ const FManifestLocale& UGameScriptManifest::GetLocaleMetadata(int32 Index) const
 	return Locales[Index];
 }
 
+FString UGameScriptManifest::GetSnapshotPath(int32 Index, bool bAllowStreaming) const
+{
+	const FManifestLocale& LocaleMetadata = GetLocaleMetadata(Index);
+	FString SnapshotPath = FPaths::Combine(BasePath, TEXT("locales"), LocaleMetadata.Name + TEXT(".gsb"));
+
+	// An installed patch wins, but only while it matches this manifest's hash
+	// (a newer build shipping its own snapshot must not be shadowed by an old patch)
+	FString PatchedPath = GetPatchedSnapshotPath(Index);
+	FString PatchedHash;
+	if (!LocaleMetadata.Hash.IsEmpty()
+		&& FFileHelper::LoadFileToString(PatchedHash, *(PatchedPath + TEXT(".hash")))
+		&& PatchedHash.TrimStartAndEnd().Equals(LocaleMetadata.Hash, ESearchCase::IgnoreCase)
+		&& FPaths::FileExists(PatchedPath))
+	{
+		return PatchedPath;
+	}
+
+	// Prefer the chunked snapshot when streaming is enabled and it has been packed
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+	if (bAllowStreaming && Settings && Settings->bStreamConversationText)
+	{
+		FString ChunkedPath = FPaths::ChangeExtension(SnapshotPath, GameScriptChunked::Extension());
+		if (FPaths::FileExists(ChunkedPath))
+		{
+			return ChunkedPath;
+		}
+	}
+
+	// Then the split layout (shared structure + per-locale string table), if one was produced
+	FString StringTablePath = FPaths::ChangeExtension(SnapshotPath, GameScriptSplit::StringTableExtension());
+	if (FPaths::FileExists(StringTablePath) && FPaths::FileExists(GameScriptSplit::GetStructurePath(BasePath)))
+	{
+		return StringTablePath;
+	}
+
+	// Then a block-compressed snapshot, if one was packed
+	FString CompressedPath = FPaths::ChangeExtension(SnapshotPath, GameScriptCompressed::Extension());
+	if (FPaths::FileExists(CompressedPath))
+	{
+		return CompressedPath;
+	}
+
+	return SnapshotPath;
+}
+
+FString UGameScriptManifest::GetPatchedSnapshotPath(int32 Index) const
+{
+	const FManifestLocale& LocaleMetadata = GetLocaleMetadata(Index);
+	return FPaths::Combine(FPaths::ProjectPersistentDownloadDir(), TEXT("GameScript"), TEXT("locales"), LocaleMetadata.Name + TEXT(".gsb"));
+}
+
+const TArray<int32>& UGameScriptManifest::GetFallbackChain(int32 Index) const
+{
+	static const TArray<int32> NoFallbacks;
+	return FallbackChains.IsValidIndex(Index) ? FallbackChains[Index] : NoFallbacks;
+}
+
 UGameScriptDatabase* UGameScriptManifest::LoadDatabase(FLocaleRef Locale)
 {
 	if (!Locale.IsValid())
@@ -42,11 +128,11 @@ UGameScriptDatabase* UGameScriptManifest::LoadDatabase(FLocaleRef Locale)
 	}
 
 	// Build snapshot path (using locale name, matching Unity's convention)
-	FString SnapshotPath = FPaths::Combine(BasePath, TEXT("locales"), LocaleMetadata.Name + TEXT(".gsb"));
+	FString SnapshotPath = GetSnapshotPath(Locale.Index);
 
 	// Create and load database
 	UGameScriptDatabase* Database = NewObject<UGameScriptDatabase>();
-	if (!Database->LoadSnapshot(SnapshotPath))
+	if (!Database->LoadSnapshot(SnapshotPath, LocaleMetadata.Hash))
 	{
 		UE_LOG(LogGameScript, Error, TEXT("Failed to load snapshot at %s"), *SnapshotPath);
 		return nullptr;
@@ -56,6 +142,14 @@ UGameScriptDatabase* UGameScriptManifest::LoadDatabase(FLocaleRef Locale)
 	Database->SetManifestAndBasePath(this, BasePath);
 	Database->SetCurrentLocaleIndex(Locale.Index);
 
+#if !UE_BUILD_SHIPPING
+	// Development: follow re-exports of this locale while the game runs
+	if (GetDefault<UGameScriptSettings>()->bRuntimeHotReload)
+	{
+		Database->SetRuntimeHotReloadEnabled(true);
+	}
+#endif
+
 	return Database;
 }
 
@@ -1,22 +1,33 @@
 #include "GameScriptRunner.h"
 #include "GameScriptDatabase.h"
+#include "GameScriptManifest.h"
 #include "GameScriptSettings.h"
 #include "JumpTableBuilder.h"
 #include "RunnerContext.h"
 #include "GSCompletionHandle.h"
+#include "ConversationReplay.h"
 #include "GameScript.h"
-#include "CldrPluralRules.h"
-#include "VariantResolver.h"
-#include "Iso4217.h"
 #include "Generated/snapshot_generated.h"
-#include "Internationalization/Internationalization.h"
-#include "Internationalization/Culture.h"
 #include "GameFramework/Actor.h"
 #include "GameplayTasksComponent.h"
 
 UGameScriptRunner::UGameScriptRunner()
+	: ContextPool(MakeShared<FRunnerContextPool>())
 {
-	// Default constructor (UObject requirement)
+}
+
+void UGameScriptRunner::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+	Super::AddReferencedObjects(InThis, Collector);
+
+	// Only active contexts hold references (EnterIdle clears them)
+	UGameScriptRunner* This = CastChecked<UGameScriptRunner>(InThis);
+	for (int32 Slot : This->ActiveSlots)
+	{
+		FRunnerContext& Context = (*This->ContextPool)[Slot];
+		Collector.AddReferencedObject(Context.ActiveTask, This);
+		Collector.AddReferencedObject(Context.PendingHandle, This);
+	}
 }
 
 void UGameScriptRunner::Initialize(UGameScriptDatabase* InDatabase, UGameScriptSettings* InSettings)
@@ -35,13 +46,28 @@ void UGameScriptRunner::Initialize(UGameScriptDatabase* InDatabase, UGameScriptS
 	// Build jump tables from global registrations
 	BuildJumpTables();
 
+	// Allocated once; recording never allocates
+	Recorder.SetCapacity(Settings->ConversationRecorderCapacity);
+
 	// Subscribe to locale changes to invalidate caches
 	Database->OnLocaleChanged.AddDynamic(this, &UGameScriptRunner::OnLocaleChanged);
 
-	// Pre-allocate context pool
+	// Runtime hot reload changes node indices under running conversations
+	Database->OnSnapshotReloading.AddDynamic(this, &UGameScriptRunner::OnSnapshotReloading);
+	Database->OnSnapshotReloaded.AddDynamic(this, &UGameScriptRunner::OnSnapshotReloaded);
+
+	// A snapshot that fails background verification is unloaded under running conversations
+	Database->OnSnapshotUnloading.AddDynamic(this, &UGameScriptRunner::OnSnapshotUnloading);
+
+	// Look-ahead text tasks read the snapshot off-thread
+	Database->OnSnapshotMemoryReleasing.AddUObject(this, &UGameScriptRunner::WaitForTextPrefetch);
+
+	// Pre-allocate the slot map
 	int32 PoolSize = Settings->MaxConcurrentConversations;
-	ContextPool.Reserve(PoolSize);
-	ActiveContexts.Reserve(PoolSize);
+	SlotGenerations.Reserve(PoolSize);
+	FreeSlots.Reserve(PoolSize);
+	ActiveSlots.Reserve(PoolSize);
+	ActivePositions.Reserve(PoolSize);
 }
 
 FActiveConversation UGameScriptRunner::StartConversation(
@@ -49,26 +75,127 @@ FActiveConversation UGameScriptRunner::StartConversation(
 	TScriptInterface<IGameScriptListener> Listener,
 	AActor* TaskOwner)
 {
-	if (!Listener.GetObject())
+	// Find conversation in database
+	FConversationRef Conv = Database->FindConversation(ConversationId);
+	if (!Conv.IsValid())
 	{
-		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - Listener is null"));
+		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - Conversation %d not found"), ConversationId);
 		return FActiveConversation();
 	}
 
-	if (!TaskOwner)
+	return StartConversationInternal(Conv, FNodeRef(), false, 0, Listener, TaskOwner);
+}
+
+FActiveConversation UGameScriptRunner::StartConversationAtNode(
+	int32 ConversationId,
+	int32 NodeId,
+	TScriptInterface<IGameScriptListener> Listener,
+	AActor* TaskOwner)
+{
+	FConversationRef Conv = Database->FindConversation(ConversationId);
+	FNodeRef Node = Database->FindNode(NodeId);
+	if (!Conv.IsValid() || !Node.IsValid() || Node.GetConversationId() != ConversationId)
 	{
-		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - TaskOwner is null"));
+		UE_LOG(LogGameScript, Error, TEXT("StartConversationAtNode failed - Node %d not found in conversation %d"), NodeId, ConversationId);
 		return FActiveConversation();
 	}
 
-	// Find conversation in database
-	FConversationRef Conv = Database->FindConversation(ConversationId);
+	return StartConversationInternal(Conv, Node, false, 0, Listener, TaskOwner);
+}
+
+bool UGameScriptRunner::SaveConversation(FActiveConversation Handle, FGSConversationSave& OutSave) const
+{
+	FRunnerContext* Context = ValidateHandle(Handle);
+	return Context && Context->IsActive() && Context->Save(OutSave);
+}
+
+FActiveConversation UGameScriptRunner::RestoreConversation(
+	const FGSConversationSave& Save,
+	TScriptInterface<IGameScriptListener> Listener,
+	AActor* TaskOwner)
+{
+	FConversationRef Conv = Database->FindConversation(Save.ConversationId);
+	FNodeRef Node = Database->FindNode(Save.NodeId);
+	if (!Save.IsValid() || !Conv.IsValid() || !Node.IsValid() || Node.GetConversationId() != Save.ConversationId)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("RestoreConversation failed - Node %d not found in conversation %d"), Save.NodeId, Save.ConversationId);
+		return FActiveConversation();
+	}
+
+	const bool bAtDecision = Save.ResumePoint == EGSConversationResumePoint::Decision;
+	return StartConversationInternal(Conv, Node, bAtDecision, Save.ChoiceFingerprint, Listener, TaskOwner);
+}
+
+FActiveConversation UGameScriptRunner::ReplayConversation(TConstArrayView<FGSRecordedEvent> Events, int32 StartIndex, AActor* TaskOwner)
+{
+	if (!Events.IsValidIndex(StartIndex) || Events[StartIndex].Type != EGSRecordedEvent::Start)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("ReplayConversation failed - event %d is not a conversation start"), StartIndex);
+		return FActiveConversation();
+	}
+
+	const FGSRecordedEvent& Start = Events[StartIndex];
+	FConversationRef Conv = Database->FindConversation(Start.Value);
 	if (!Conv.IsValid())
 	{
-		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - Conversation %d not found"), ConversationId);
+		UE_LOG(LogGameScript, Error, TEXT("ReplayConversation failed - Conversation %d not found"), Start.Value);
 		return FActiveConversation();
 	}
 
+	// Recorded resume point, if the conversation was started at a node
+	FNodeRef ResumeNode;
+	bool bResumeAtDecision = false;
+	const int32 ResumeIndex = StartIndex + 1;
+	if (Events.IsValidIndex(ResumeIndex) && Events[ResumeIndex].Type == EGSRecordedEvent::Resume && Events[ResumeIndex].ContextId == Start.ContextId)
+	{
+		ResumeNode = Database->FindNode(Events[ResumeIndex].NodeId);
+		bResumeAtDecision = Events[ResumeIndex].Value != 0;
+		if (!ResumeNode.IsValid())
+		{
+			UE_LOG(LogGameScript, Error, TEXT("ReplayConversation failed - resume node %d not found"), Events[ResumeIndex].NodeId);
+			return FActiveConversation();
+		}
+	}
+
+	TSharedPtr<FGSReplayScript> Script = MakeShared<FGSReplayScript>();
+	Script->Build(Events, StartIndex);
+
+	ReplayListeners.RemoveAll([](const TObjectPtr<UObject>& Listener)
+	{
+		return !Listener || CastChecked<UGSReplayListener>(Listener)->IsFinished();
+	});
+
+	UGSReplayListener* Listener = NewObject<UGSReplayListener>(this);
+	Listener->Initialize(Script);
+	ReplayListeners.Add(Listener);
+
+	// No fingerprint check: the recorded choices decide the path
+	return StartConversationInternal(Conv, ResumeNode, bResumeAtDecision, 0, Listener, TaskOwner, Script);
+}
+
+FActiveConversation UGameScriptRunner::StartConversationInternal(
+	FConversationRef Conv,
+	FNodeRef ResumeNode,
+	bool bResumeAtDecision,
+	int32 ResumeFingerprint,
+	TScriptInterface<IGameScriptListener> Listener,
+	AActor* TaskOwner,
+	TSharedPtr<FGSReplayScript> Replay)
+{
+	if (!Listener.GetObject())
+	{
+		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - Listener is null"));
+		return FActiveConversation();
+	}
+
+	if (!TaskOwner)
+	{
+		UE_LOG(LogGameScript, Error, TEXT("StartConversation failed - TaskOwner is null"));
+		return FActiveConversation();
+	}
+
+	const int32 ConversationId = Conv.GetId();
+
 	// Ensure TaskOwner has a UGameplayTasksComponent
 	UGameplayTasksComponent* TasksComponent = TaskOwner->FindComponentByClass<UGameplayTasksComponent>();
 	if (!TasksComponent)
@@ -79,29 +206,37 @@ FActiveConversation UGameScriptRunner::StartConversation(
 	}
 
 	// Acquire context from pool
-	URunnerContext* Context = AcquireContext();
+	FActiveConversation Handle;
+	FRunnerContext* Context = AcquireContext(Handle);
 	if (!Context)
 	{
 		UE_LOG(LogGameScript, Error, TEXT("Failed to acquire context - pool exhausted"));
 		return FActiveConversation();
 	}
 
-	// Initialize context (increments its own sequence counter)
-	Context->Initialize(this, ConversationId, Listener, TasksComponent);
+	// Keep the conversation's text resident while it runs (no-op unless streaming)
+	Database->PinConversation(ConversationId);
 
-	// Get context ID and sequence for the handle
-	int32 ContextId = Context->GetContextId();
-	int32 Sequence = Context->GetSequence();
+	// Initialize context
+	Context->Initialize(this, Handle, ConversationId, Listener, TasksComponent);
+	Context->SetReplay(MoveTemp(Replay));
+
+	Recorder.Record(EGSRecordedEvent::Start, Context->GetContextId(), ResumeNode.IsValid() ? ResumeNode.GetId() : -1, ConversationId);
+	if (ResumeNode.IsValid())
+	{
+		Recorder.Record(EGSRecordedEvent::Resume, Context->GetContextId(), ResumeNode.GetId(), bResumeAtDecision ? 1 : 0);
+		Context->SetResumePoint(ResumeNode, bResumeAtDecision, ResumeFingerprint);
+	}
 
 	// Start execution
 	Context->Start();
 
-	return FActiveConversation(ContextId, Sequence);
+	return Handle;
 }
 
 void UGameScriptRunner::StopConversation(FActiveConversation Handle)
 {
-	URunnerContext* Context = ValidateHandle(Handle);
+	FRunnerContext* Context = ValidateHandle(Handle);
 	if (!Context)
 	{
 		return;
@@ -114,31 +249,26 @@ void UGameScriptRunner::StopConversation(FActiveConversation Handle)
 
 void UGameScriptRunner::StopAllConversations()
 {
-	// Collect context IDs first to avoid modifying map during iteration
-	TArray<int32> ContextIds;
-	ContextIds.Reserve(ActiveContexts.Num());
-	for (const auto& Pair : ActiveContexts)
+	// Backwards: a context that releases during Cancel() swap-removes itself, moving an
+	// already-visited slot into its position. Contexts started by listeners append past the end.
+	for (int32 i = ActiveSlots.Num() - 1; i >= 0; --i)
 	{
-		ContextIds.Add(Pair.Key);
-	}
+		if (i >= ActiveSlots.Num())
+		{
+			continue;   // A listener stopped other conversations synchronously
+		}
 
-	// Cancel each context (Cancel() calls ReleaseContext() which removes from ActiveContexts)
-	for (int32 ContextId : ContextIds)
-	{
-		if (TObjectPtr<URunnerContext>* ContextPtr = ActiveContexts.Find(ContextId))
+		FRunnerContext& Context = (*ContextPool)[ActiveSlots[i]];
+		if (Context.IsActive() && !Context.IsCancelled())
 		{
-			URunnerContext* Context = *ContextPtr;
-			if (Context && Context->IsActive())
-			{
-				Context->Cancel();
-			}
+			Context.Cancel();
 		}
 	}
 }
 
 bool UGameScriptRunner::IsActive(FActiveConversation Handle) const
 {
-	URunnerContext* Context = ValidateHandle(Handle);
+	FRunnerContext* Context = ValidateHandle(Handle);
 	if (!Context)
 	{
 		return false;
@@ -147,64 +277,81 @@ bool UGameScriptRunner::IsActive(FActiveConversation Handle) const
 	return Context->IsActive();
 }
 
-URunnerContext* UGameScriptRunner::ValidateHandle(FActiveConversation Handle) const
+FRunnerContext* UGameScriptRunner::ValidateHandle(FActiveConversation Handle) const
 {
-	// Check handle validity
-	if (!Handle.IsValid())
+	// One index and compare: released slots have moved on to a newer generation
+	if (!Handle.IsValid() || !SlotGenerations.IsValidIndex(Handle.Slot) || SlotGenerations[Handle.Slot] != Handle.Generation)
 	{
 		return nullptr;
 	}
+	return &(*ContextPool)[Handle.Slot];
+}
 
-	// O(1) lookup by ContextId
-	const TObjectPtr<URunnerContext>* ContextPtr = ActiveContexts.Find(Handle.ContextId);
-	if (!ContextPtr)
+FRunnerContext* UGameScriptRunner::AcquireContext(FActiveConversation& OutHandle)
+{
+	int32 Slot;
+
+	// Try to reuse an idle slot (O(1) pop from end)
+	if (FreeSlots.Num() > 0)
 	{
-		return nullptr;
+		Slot = FreeSlots.Pop();
 	}
-
-	URunnerContext* Context = *ContextPtr;
-
-	// Validate sequence to detect stale handles after context reuse
-	if (!Context || Context->GetSequence() != Handle.Sequence)
+	else
 	{
-		return nullptr;
+		// Create a new context; it owns the new slot from now on
+		Slot = ContextPool->Add();
+		SlotGenerations.Add(0);
+		ActivePositions.Add(INDEX_NONE);
 	}
 
-	return Context;
+	ActivePositions[Slot] = ActiveSlots.Add(Slot);
+	OutHandle = FActiveConversation(Slot, SlotGenerations[Slot]);
+	return &(*ContextPool)[Slot];
 }
 
-URunnerContext* UGameScriptRunner::AcquireContext()
+void UGameScriptRunner::ReleaseContext(FRunnerContext* Context)
 {
-	URunnerContext* Context = nullptr;
+	if (!Context)
+	{
+		return;
+	}
 
-	// Try to reuse from pool (O(1) pop from end)
-	if (ContextPool.Num() > 0)
+	const int32 Slot = Context->GetHandle().Slot;
+	if (!ActivePositions.IsValidIndex(Slot) || ActivePositions[Slot] == INDEX_NONE)
 	{
-		Context = ContextPool.Pop();
+		return;
 	}
-	else
+
+	// Stale handles stop matching (O(1), no hashing)
+	++SlotGenerations[Slot];
+
+	// Swap-remove from the dense active list
+	const int32 Position = ActivePositions[Slot];
+	ActiveSlots.RemoveAtSwap(Position);
+	if (ActiveSlots.IsValidIndex(Position))
 	{
-		// Create new context with this runner as outer for proper GC
-		Context = NewObject<URunnerContext>(this);
+		ActivePositions[ActiveSlots[Position]] = Position;
 	}
+	ActivePositions[Slot] = INDEX_NONE;
 
-	// Add to active map using context's unique ID (O(1) insert)
-	ActiveContexts.Add(Context->GetContextId(), Context);
-	return Context;
+	// Release the text pin taken in StartConversation
+	Database->UnpinConversation(Context->GetConversationId());
+
+	// Return to pool (O(1) push to end)
+	FreeSlots.Add(Slot);
 }
 
-void UGameScriptRunner::ReleaseContext(URunnerContext* Context)
+void UGameScriptRunner::SetConditionThreadSafe(int32 NodeId, bool bThreadSafe)
 {
-	if (!Context)
+	ThreadSafeOverrides.Add(NodeId, bThreadSafe);
+
+	FNodeRef Node = Database->FindNode(NodeId);
+	if (!Node.IsValid())
 	{
+		UE_LOG(LogGameScript, Warning, TEXT("SetConditionThreadSafe: unknown node ID %d"), NodeId);
 		return;
 	}
-
-	// Remove from active map (O(1) removal)
-	ActiveContexts.Remove(Context->GetContextId());
-
-	// Return to pool (O(1) push to end)
-	ContextPool.Add(Context);
+	ThreadSafeConditions[Node.Index] = bThreadSafe;
 }
 
 UGSCompletionHandle* UGameScriptRunner::AcquireHandle()
@@ -227,7 +374,15 @@ void UGameScriptRunner::ReleaseHandle(UGSCompletionHandle* Handle)
 
 void UGameScriptRunner::BuildJumpTables()
 {
-	FJumpTableBuilder::BuildJumpTables(Database, Conditions, Actions);
+	FJumpTableBuilder::BuildJumpTables(Database, Conditions, Actions, &VolatileConditions, &ThreadSafeConditions);
+	for (const TPair<int32, bool>& Override : ThreadSafeOverrides)
+	{
+		FNodeRef Node = Database->FindNode(Override.Key);
+		if (Node.IsValid())
+		{
+			ThreadSafeConditions[Node.Index] = Override.Value;
+		}
+	}
 
 	// Validate jump tables in development builds
 #if !UE_BUILD_SHIPPING
@@ -244,319 +399,159 @@ void UGameScriptRunner::BuildJumpTables()
 // ---------------------------------------------------------------------------
 
 FString UGameScriptRunner::ResolveText(int32 LocalizationIdx, FNodeRef Node, const FTextResolutionParams& Parms)
+{
+	return ResolveText(LocalizationIdx, Node, Parms, FLocaleRef());
+}
+
+FString UGameScriptRunner::ResolveText(int32 LocalizationIdx, FNodeRef Node, const FTextResolutionParams& Parms, FLocaleRef Locale)
 {
 	if (LocalizationIdx < 0)
 	{
 		return FString();
 	}
 
-	const GameScript::Snapshot* Snap = Database->GetSnapshot();
-	const GameScript::Localization* Loc = Snap->localizations()->Get(LocalizationIdx);
+	if (!Locale.IsValid())
+	{
+		Locale = Database->GetCurrentLocale();
+	}
 
-	// 1. Resolve gender
-	EGSGenderCategory Gender = ResolveGender(Loc, Parms, Snap);
+	FString Text = ResolveTextInLocale(LocalizationIdx, Parms, Locale);
+	if (!Text.IsEmpty() || !Locale.IsValid())
+	{
+		return Text;
+	}
 
-	// 2. Resolve plural category (cardinal or ordinal based on PluralArg.Type)
-	EGSPluralCategory Plural = EGSPluralCategory::Other;
-	if (Parms.bHasPlural)
+	// Missing translation: walk the manifest fallback chain (resident string tables only)
+	for (int32 FallbackIndex : Locale.Manifest->GetFallbackChain(Locale.Index))
 	{
-		EnsureCldrRulesCached(Snap);
-		if (Parms.Plural.Type == EGSPluralType::Ordinal)
-		{
-			// Ordinal rules are integer-only; clamp int64 to int32
-			int32 OrdinalN = static_cast<int32>(FMath::Clamp(Parms.Plural.Value, (int64)INT32_MIN, (int64)INT32_MAX));
-			Plural = FCldrPluralRules::ApplyOrdinalRule(CachedOrdinalRuleIdx, OrdinalN);
-		}
-		else
+		Text = ResolveTextInLocale(LocalizationIdx, Parms, FLocaleRef(Locale.Manifest, FallbackIndex));
+		if (!Text.IsEmpty())
 		{
-			Plural = FCldrPluralRules::ApplyRule(CachedCardinalRuleIdx, Parms.Plural.Value, Parms.Plural.Precision);
+			break;
 		}
 	}
 
-	// 3. Select variant
-	FString Text = FVariantResolver::Resolve(Loc, Gender, Plural);
-	if (Text.IsEmpty())
-	{
-		return FString();
-	}
+	return Text;
+}
 
-	// 4. Template substitution — only when is_templated is set and there are args
-	bool bHasPlural = Parms.bHasPlural;
-	bool bHasArgs = Parms.Args.Num() > 0;
-	if (Loc->is_templated() && (bHasPlural || bHasArgs))
+FString UGameScriptRunner::ResolveTextInLocale(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale)
+{
+	// Structure (actors, genders) is shared; only the text comes from the requested locale
+	const GameScript::Snapshot* Snap = Database->GetSnapshot();
+	const GameScript::Localization* Loc = Database->GetLocalizationText(LocalizationIdx, Locale.IsValid() ? Locale.Index : INDEX_NONE);
+	if (!Loc)
 	{
-		Text = ApplyTemplate(Text, Parms);
+		return FString();
 	}
 
-	return Text;
+	return FGSTextResolver::ResolveLocalization(Loc, Snap, Parms, GetLocaleFormat(Locale), SharedStringBuilder);
 }
 
-EGSGenderCategory UGameScriptRunner::ResolveGender(
-	const GameScript::Localization* Loc,
-	const FTextResolutionParams& Parms,
-	const GameScript::Snapshot* Snapshot)
+const FGSLocaleFormat& UGameScriptRunner::GetLocaleFormat(FLocaleRef Locale)
 {
-	// Caller-supplied override always wins
-	if (Parms.bHasGenderOverride)
+	const int32 Key = Locale.IsValid() ? Locale.Index : INDEX_NONE;
+	if (const FGSLocaleFormat* Cached = LocaleFormats.Find(Key))
 	{
-		return Parms.GenderOverride;
+		return *Cached;
 	}
 
-	// Derive from subject actor's grammatical gender (subject_actor takes precedence)
-	int32 ActorIdx = Loc->subject_actor_idx();
-	if (ActorIdx >= 0)
+	FString LocaleName;
+	if (Locale.IsValid())
 	{
-		GameScript::GrammaticalGender GG = Snapshot->actors()->Get(ActorIdx)->grammatical_gender();
-		switch (GG)
+		LocaleName = Locale.GetCode();
+	}
+	else
+	{
+		const GameScript::Snapshot* Snap = Database->GetLocaleSnapshot();
+		if (Snap && Snap->locale_name())
 		{
-			case GameScript::GrammaticalGender_Masculine: return EGSGenderCategory::Masculine;
-			case GameScript::GrammaticalGender_Feminine:  return EGSGenderCategory::Feminine;
-			case GameScript::GrammaticalGender_Neuter:    return EGSGenderCategory::Neuter;
-			default:                                      return EGSGenderCategory::Other; // Other + Dynamic
+			LocaleName = FString(UTF8_TO_TCHAR(Snap->locale_name()->c_str()));
 		}
 	}
 
-	// Fall back to direct gender override (GenderCategory::Other when unset)
-	return static_cast<EGSGenderCategory>(Loc->subject_gender());
+	return LocaleFormats.Add(Key, FGSLocaleFormat::Make(LocaleName));
 }
 
-FString UGameScriptRunner::ApplyTemplate(const FString& Text, const FTextResolutionParams& Parms)
+void UGameScriptRunner::OnLocaleChanged()
 {
-	SharedStringBuilder.Reset();
+	LocaleFormats.Reset();
 
-	const TCHAR* Data = *Text;
-	int32 Len = Text.Len();
-	int32 i = 0;
+	// Prefetched lines are in the previous locale
+	ResetTextPrefetch();
+}
 
-	while (i < Len)
+void UGameScriptRunner::WaitForTextPrefetch()
+{
+	// Idle contexts may still have tasks in flight
+	for (int32 Slot = 0; Slot < ContextPool->Num(); ++Slot)
 	{
-		TCHAR C = Data[i];
-
-		if (C == TEXT('{'))
-		{
-			// Escaped brace: {{ -> '{'
-			if (i + 1 < Len && Data[i + 1] == TEXT('{'))
-			{
-				SharedStringBuilder.AppendChar(TEXT('{'));
-				i += 2;
-				continue;
-			}
-
-			// Scan for matching '}'
-			int32 Start = i + 1;
-			int32 End = Start;
-			while (End < Len && Data[End] != TEXT('}'))
-			{
-				End++;
-			}
-
-			if (End >= Len)
-			{
-				// Malformed — no closing brace; emit rest of string literally
-				SharedStringBuilder.Append(Data + i, Len - i);
-				break;
-			}
-
-			FString Placeholder(End - Start, Data + Start);
-
-			// Try PluralArg first (formatted as locale-aware number)
-			bool bResolved = false;
-			if (Parms.bHasPlural && Parms.Plural.Name.Equals(Placeholder, ESearchCase::CaseSensitive))
-			{
-				if (Parms.Plural.Precision > 0)
-				{
-					// Decimal: format with Precision decimal places
-					double DisplayValue = static_cast<double>(Parms.Plural.Value) / Pow10(Parms.Plural.Precision);
-					FNumberFormattingOptions Opts;
-					Opts.SetMaximumFractionalDigits(Parms.Plural.Precision);
-					Opts.SetMinimumFractionalDigits(Parms.Plural.Precision);
-					SharedStringBuilder.Append(FText::AsNumber(DisplayValue, &Opts, GetCulture()).ToString());
-				}
-				else
-				{
-					// Integer: grouped integer formatting
-					FNumberFormattingOptions Opts;
-					Opts.SetMaximumFractionalDigits(0);
-					Opts.SetMinimumFractionalDigits(0);
-					SharedStringBuilder.Append(FText::AsNumber(Parms.Plural.Value, &Opts, GetCulture()).ToString());
-				}
-				bResolved = true;
-			}
-
-			// Try typed Args
-			if (!bResolved)
-			{
-				for (int32 A = 0; A < Parms.Args.Num(); A++)
-				{
-					if (Parms.Args[A].Name.Equals(Placeholder, ESearchCase::CaseSensitive))
-					{
-						FString Formatted;
-						FormatArg(Parms.Args[A], Formatted);
-						SharedStringBuilder.Append(Formatted);
-						bResolved = true;
-						break;
-					}
-				}
-			}
-
-			// Unknown placeholder — pass through unchanged
-			if (!bResolved)
-			{
-				SharedStringBuilder.AppendChar(TEXT('{'));
-				SharedStringBuilder.Append(Placeholder);
-				SharedStringBuilder.AppendChar(TEXT('}'));
-			}
-
-			i = End + 1; // skip past '}'
-		}
-		else if (C == TEXT('}'))
-		{
-			// Escaped brace: }} -> '}'
-			if (i + 1 < Len && Data[i + 1] == TEXT('}'))
-			{
-				SharedStringBuilder.AppendChar(TEXT('}'));
-				i += 2;
-			}
-			else
-			{
-				// Lone '}' — emit literally (lenient)
-				SharedStringBuilder.AppendChar(TEXT('}'));
-				i++;
-			}
-		}
-		else
-		{
-			SharedStringBuilder.AppendChar(C);
-			i++;
-		}
+		(*ContextPool)[Slot].WaitForTextPrefetch();
 	}
-
-	return SharedStringBuilder;
 }
 
-void UGameScriptRunner::FormatArg(const FGSArg& Arg, FString& OutResult)
+void UGameScriptRunner::ResetTextPrefetch()
 {
-	switch (Arg.Type)
+	for (int32 Slot : ActiveSlots)
 	{
-		case EGSArgType::String:
-		{
-			OutResult = Arg.StringValue;
-			break;
-		}
-
-		case EGSArgType::Int:
-		{
-			FNumberFormattingOptions Opts;
-			Opts.SetMaximumFractionalDigits(0);
-			Opts.SetMinimumFractionalDigits(0);
-			OutResult = FText::AsNumber(Arg.NumericValue, &Opts, GetCulture()).ToString();
-			break;
-		}
-
-		case EGSArgType::Decimal:
-		{
-			double Value = static_cast<double>(Arg.NumericValue) / Pow10(Arg.Precision);
-			FNumberFormattingOptions Opts;
-			Opts.SetMaximumFractionalDigits(Arg.Precision);
-			Opts.SetMinimumFractionalDigits(Arg.Precision);
-			OutResult = FText::AsNumber(Value, &Opts, GetCulture()).ToString();
-			break;
-		}
-
-		case EGSArgType::Percent:
-		{
-			// Value is percentage x 10^precision (e.g., 155 with precision 1 = 15.5%)
-			// Divide by 10^precision to get the percentage, then by 100 for fractional form
-			double Pct = static_cast<double>(Arg.NumericValue) / Pow10(Arg.Precision) / 100.0;
-			FNumberFormattingOptions Opts;
-			Opts.SetMaximumFractionalDigits(Arg.Precision);
-			Opts.SetMinimumFractionalDigits(Arg.Precision);
-			OutResult = FText::AsPercent(Pct, &Opts, GetCulture()).ToString();
-			break;
-		}
-
-		case EGSArgType::Currency:
-		{
-			int32 Decimals = FIso4217::GetMinorUnitDigits(Arg.CurrencyCode);
-			double Value = static_cast<double>(Arg.NumericValue) / Pow10(Decimals);
-			FString Symbol = FIso4217::GetSymbol(Arg.CurrencyCode, CachedLocaleName);
-			FNumberFormattingOptions Opts;
-			Opts.SetMaximumFractionalDigits(Decimals);
-			Opts.SetMinimumFractionalDigits(Decimals);
-			OutResult = FText::AsCurrencyBase(Arg.NumericValue, Arg.CurrencyCode, GetCulture()).ToString();
-			break;
-		}
-
-		case EGSArgType::RawInt:
-		{
-			OutResult = FString::Printf(TEXT("%lld"), Arg.NumericValue);
-			break;
-		}
+		(*ContextPool)[Slot].ResetTextPrefetch();
 	}
 }
 
-FCulturePtr UGameScriptRunner::GetCulture()
+void UGameScriptRunner::OnSnapshotReloading()
 {
-	if (CachedCulture.IsValid())
+	for (int32 Slot : ActiveSlots)
 	{
-		return CachedCulture;
+		(*ContextPool)[Slot].CaptureNodeIds();
 	}
+}
 
-	const GameScript::Snapshot* Snap = Database->GetSnapshot();
-	if (!Snap || !Snap->locale_name())
+void UGameScriptRunner::OnSnapshotReloaded()
+{
+	// Node indices (and possibly the condition/action set) changed
+	BuildJumpTables();
+	LocaleFormats.Reset();
+	ResetTextPrefetch();
+
+	// Remap first, then cancel: cancellation can release contexts from ActiveSlots
+	TArray<FRunnerContext*> Orphaned;
+	for (int32 Slot : ActiveSlots)
 	{
-		CachedCulture = FInternationalization::Get().GetDefaultCulture();
-		return CachedCulture;
+		FRunnerContext& Context = (*ContextPool)[Slot];
+		if (Context.IsActive() && !Context.RemapNodeIds())
+		{
+			Orphaned.Add(&Context);
+		}
 	}
 
-	CachedLocaleName = FString(UTF8_TO_TCHAR(Snap->locale_name()->c_str()));
-	// Normalize underscore to hyphen for ICU
-	FString Normalized = CachedLocaleName.Replace(TEXT("_"), TEXT("-"));
-	CachedCulture = FInternationalization::Get().GetCulture(Normalized);
-	if (!CachedCulture.IsValid())
+	for (FRunnerContext* Context : Orphaned)
 	{
-		CachedCulture = FInternationalization::Get().GetDefaultCulture();
+		UE_LOG(LogGameScript, Warning, TEXT("Hot reload removed the current node of conversation %d - cancelling it"),
+			Context->GetConversationId());
+		Context->Cancel();
 	}
-
-	return CachedCulture;
 }
 
-void UGameScriptRunner::EnsureCldrRulesCached(const GameScript::Snapshot* Snapshot)
+void UGameScriptRunner::OnSnapshotUnloading()
 {
-	if (bCldrRulesCached)
+	// Nothing is left to run against: end every conversation while its refs still resolve
+	TArray<FRunnerContext*> Active;
+	for (int32 Slot : ActiveSlots)
 	{
-		return;
+		FRunnerContext& Context = (*ContextPool)[Slot];
+		if (Context.IsActive())
+		{
+			Active.Add(&Context);
+		}
 	}
 
-	FString LocaleName;
-	if (Snapshot && Snapshot->locale_name())
+	if (Active.Num() > 0)
 	{
-		LocaleName = FString(UTF8_TO_TCHAR(Snapshot->locale_name()->c_str()));
+		UE_LOG(LogGameScript, Warning, TEXT("Snapshot unloaded - cancelling %d running conversation(s)"), Active.Num());
 	}
-
-	CachedCardinalRuleIdx = FCldrPluralRules::LookupCardinalRule(LocaleName);
-	CachedOrdinalRuleIdx = FCldrPluralRules::LookupOrdinalRule(LocaleName);
-	bCldrRulesCached = true;
-}
-
-void UGameScriptRunner::OnLocaleChanged()
-{
-	CachedCulture.Reset();
-	CachedLocaleName.Empty();
-	bCldrRulesCached = false;
-}
-
-double UGameScriptRunner::Pow10(int32 Exponent)
-{
-	switch (Exponent)
+	for (FRunnerContext* Context : Active)
 	{
-		case 0: return 1.0;
-		case 1: return 10.0;
-		case 2: return 100.0;
-		case 3: return 1000.0;
-		case 4: return 10000.0;
-		case 5: return 100000.0;
-		case 6: return 1000000.0;
-		default: return FMath::Pow(10.0, static_cast<double>(Exponent));
+		Context->Cancel();
 	}
+
+	LocaleFormats.Reset();
 }
@@ -7,5 +7,18 @@ UGameScriptSettings::UGameScriptSettings()
 	MaxConcurrentConversations = 10;
 	bVerboseLogging = false;
 	bPreventSingleNodeChoices = true; // Match Unity/Godot default
+	bSpeculativeChoices = false;
+	bParallelConditions = false;
+	ParallelConditionThreshold = 16;
+	LookAheadDepth = 0;
+	ConversationRecorderCapacity = 4096;
+	bStreamConversationText = false;
+	StreamingBudgetKB = 4096;
+	SnapshotCompressionFormat = NAME_Oodle;
+	SnapshotVerification = EGSSnapshotVerification::Full;
+	bTrustManifestHash = false;
+	bBuildTextSearchIndex = false;
+	bRuntimeHotReload = false;
+	RuntimeHotReloadInterval = 1.0f;
 	EditorLocaleIndex = -1; // -1 = use primary from manifest
 }
@@ -5,7 +5,9 @@
 void FJumpTableBuilder::BuildJumpTables(
 	const UGameScriptDatabase* Database,
 	TArray<ConditionDelegate>& OutConditions,
-	TArray<ActionDelegate>& OutActions)
+	TArray<ActionDelegate>& OutActions,
+	TBitArray<>* OutVolatileConditions,
+	TBitArray<>* OutThreadSafeConditions)
 {
 	check(Database);
 
@@ -17,6 +19,14 @@ void FJumpTableBuilder::BuildJumpTables(
 	int32 NodeCount = Database->GetNodeCount();
 	OutConditions.SetNumZeroed(NodeCount);
 	OutActions.SetNumZeroed(NodeCount);
+	if (OutVolatileConditions)
+	{
+		OutVolatileConditions->Init(false, NodeCount);
+	}
+	if (OutThreadSafeConditions)
+	{
+		OutThreadSafeConditions->Init(false, NodeCount);
+	}
 
 	// 3. Place conditions from global registry
 	for (FNodeConditionRegistration* Reg : GConditionRegistrations)
@@ -24,6 +34,14 @@ void FJumpTableBuilder::BuildJumpTables(
 		if (int32* Index = NodeIdToIndex.Find(Reg->NodeId))
 		{
 			OutConditions[*Index] = Reg->Function;
+			if (OutVolatileConditions && Reg->bVolatile)
+			{
+				(*OutVolatileConditions)[*Index] = true;
+			}
+			if (OutThreadSafeConditions && Reg->bThreadSafe)
+			{
+				(*OutThreadSafeConditions)[*Index] = true;
+			}
 		}
 		else
 		{
@@ -0,0 +1,126 @@
+#include "PropertyColumn.h"
+#include "Generated/snapshot_generated.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+// Case-sensitive ordering for string values (FString's operator< ignores case)
+static bool StringLess(const FString& A, const FString& B)
+{
+	return A.Compare(B, ESearchCase::CaseSensitive) < 0;
+}
+
+// Decimal values are stored as float: round a finite bound the same way so equality holds
+static double ToDecimalBound(double Bound)
+{
+	return FMath::Abs(Bound) <= TNumericLimits<float>::Max() ? static_cast<double>(static_cast<float>(Bound)) : Bound;
+}
+
+FGSPropertyColumn::FGSPropertyColumn(const GameScript::Snapshot* Snapshot, int32 TemplateIndex)
+{
+	Type = static_cast<EGSPropertyType>(Snapshot->property_templates()->Get(TemplateIndex)->type());
+
+	struct FNumericEntry
+	{
+		double Value;
+		int32 NodeIndex;
+	};
+	struct FStringEntry
+	{
+		FString Value;
+		int32 NodeIndex;
+	};
+	TArray<FNumericEntry> NumericEntries;
+	TArray<FStringEntry> StringEntries;
+
+	const auto* Nodes = Snapshot->nodes();
+	const int32 NodeCount = Nodes ? static_cast<int32>(Nodes->size()) : 0;
+	for (int32 NodeIndex = 0; NodeIndex < NodeCount; ++NodeIndex)
+	{
+		const auto* Properties = Nodes->Get(NodeIndex)->properties();
+		if (!Properties)
+		{
+			continue;
+		}
+
+		for (const GameScript::NodeProperty* Property : *Properties)
+		{
+			if (Property->template_idx() != TemplateIndex)
+			{
+				continue;
+			}
+
+			switch (Property->value_type())
+			{
+			case GameScript::PropertyValue_int_val:
+				NumericEntries.Add({static_cast<double>(Property->value_as_int_val()->value()), NodeIndex});
+				break;
+			case GameScript::PropertyValue_decimal_val:
+				NumericEntries.Add({static_cast<double>(Property->value_as_decimal_val()->value()), NodeIndex});
+				break;
+			case GameScript::PropertyValue_bool_val:
+				NumericEntries.Add({Property->value_as_bool_val()->value() ? 1.0 : 0.0, NodeIndex});
+				break;
+			case GameScript::PropertyValue_string_val:
+				StringEntries.Add({FString(UTF8_TO_TCHAR(Property->value_as_string_val()->c_str())), NodeIndex});
+				break;
+			default:
+				break;
+			}
+			break;
+		}
+	}
+
+	// Nodes were visited in index order, so a stable sort keeps node indices ascending per value
+	Algo::StableSortBy(NumericEntries, &FNumericEntry::Value);
+	Values.Reserve(NumericEntries.Num());
+	NodeIndices.Reserve(NumericEntries.Num());
+	for (const FNumericEntry& Entry : NumericEntries)
+	{
+		Values.Add(Entry.Value);
+		NodeIndices.Add(Entry.NodeIndex);
+	}
+
+	Algo::StableSortBy(StringEntries, &FStringEntry::Value, &StringLess);
+	for (FStringEntry& Entry : StringEntries)
+	{
+		if (Strings.Num() == 0 || !Strings.Last().Equals(Entry.Value, ESearchCase::CaseSensitive))
+		{
+			Strings.Add(MoveTemp(Entry.Value));
+			Postings.AddDefaulted();
+		}
+		Postings.Last().Add(Entry.NodeIndex);
+	}
+}
+
+TConstArrayView<int32> FGSPropertyColumn::Evaluate(const FGSPropertyQuery::FFilter& Filter, bool& bOutNodeOrder) const
+{
+	bOutNodeOrder = true;
+
+	if (Filter.bString)
+	{
+		const int32 Found = Algo::LowerBound(Strings, Filter.String, &StringLess);
+		if (Found < Strings.Num() && Strings[Found].Equals(Filter.String, ESearchCase::CaseSensitive))
+		{
+			return Postings[Found];
+		}
+		return {};
+	}
+
+	if (Type == EGSPropertyType::String)
+	{
+		return {};
+	}
+
+	const double Min = Type == EGSPropertyType::Decimal ? ToDecimalBound(Filter.Min) : Filter.Min;
+	const double Max = Type == EGSPropertyType::Decimal ? ToDecimalBound(Filter.Max) : Filter.Max;
+	const int32 Begin = Filter.bMinInclusive ? Algo::LowerBound(Values, Min) : Algo::UpperBound(Values, Min);
+	const int32 End = Filter.bMaxInclusive ? Algo::UpperBound(Values, Max) : Algo::LowerBound(Values, Max);
+	if (Begin >= End)
+	{
+		return {};
+	}
+
+	// The stable build sort keeps node order within one value; across values the slice is in value order
+	bOutNodeOrder = Values[Begin] == Values[End - 1];
+	return TConstArrayView<int32>(NodeIndices.GetData() + Begin, End - Begin);
+}
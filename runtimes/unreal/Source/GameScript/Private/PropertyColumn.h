@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Refs.h"
+#include "PropertyQuery.h"
+
+namespace GameScript { struct Snapshot; }
+
+/**
+ * Columnar index of one property template's values across all nodes
+ * (built lazily by UGameScriptDatabase::QueryNodes, once per template and structure).
+ *
+ * Numeric templates (integer, decimal, boolean) keep a dense value array sorted ascending with
+ * the owning node index alongside, presorted once at build: equality and range filters are two
+ * binary searches and a slice of NodeIndices, with no per-query copy or sort.
+ * String templates keep their distinct values sorted with a posting list of node indices each.
+ * Nodes without the property are absent; a node with the template twice uses the first.
+ */
+struct FGSPropertyColumn
+{
+	EGSPropertyType Type = EGSPropertyType::String;
+
+	// Numeric: (Values[i], NodeIndices[i]) sorted by value, then node index
+	TArray<double> Values;
+	TArray<int32> NodeIndices;
+
+	// String: distinct values (case-sensitive order) and their node indices, ascending
+	TArray<FString> Strings;
+	TArray<TArray<int32>> Postings;
+
+	FGSPropertyColumn(const GameScript::Snapshot* Snapshot, int32 TemplateIndex);
+
+	/**
+	 * Find the nodes matching a filter on this column.
+	 * @param bOutNodeOrder - Set when the slice is in ascending node order (a single value);
+	 *                        a range over several values is in value order
+	 * @return Slice of this column's node indices, valid while the column lives
+	 */
+	TConstArrayView<int32> Evaluate(const FGSPropertyQuery::FFilter& Filter, bool& bOutNodeOrder) const;
+};
@@ -0,0 +1,21 @@
+#include "PropertyQuery.h"
+
+FGSPropertyQuery& FGSPropertyQuery::Equals(FName Property, const FString& Value)
+{
+	FFilter& Filter = Filters.AddDefaulted_GetRef();
+	Filter.Property = Property;
+	Filter.bString = true;
+	Filter.String = Value;
+	return *this;
+}
+
+FGSPropertyQuery& FGSPropertyQuery::AddRange(FName Property, double Min, bool bMinInclusive, double Max, bool bMaxInclusive)
+{
+	FFilter& Filter = Filters.AddDefaulted_GetRef();
+	Filter.Property = Property;
+	Filter.Min = Min;
+	Filter.Max = Max;
+	Filter.bMinInclusive = bMinInclusive;
+	Filter.bMaxInclusive = bMaxInclusive;
+	return *this;
+}
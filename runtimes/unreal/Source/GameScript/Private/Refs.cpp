@@ -19,6 +19,23 @@
 
 // --- Helper Functions ---
 
+// Resolve non-plural text in the current locale, walking its fallback chain on a miss
+// Shared by actor names and localization refs
+static FString ResolveStaticText(const UGameScriptDatabase* Database, int32 LocIdx)
+{
+	const GameScript::Localization* Loc = Database->GetLocalizationText(LocIdx);
+	FString Text = FVariantResolver::Resolve(Loc, FNodeRef::ResolveStaticGender(Loc, Database->GetSnapshot()), EGSPluralCategory::Other);
+
+	const TArray<int32>& Fallbacks = Database->GetFallbackChain();
+	for (int32 i = 0; Text.IsEmpty() && i < Fallbacks.Num(); ++i)
+	{
+		Loc = Database->GetLocalizationText(LocIdx, Fallbacks[i]);
+		Text = FVariantResolver::Resolve(Loc, FNodeRef::ResolveStaticGender(Loc, Database->GetSnapshot()), EGSPluralCategory::Other);
+	}
+
+	return Text;
+}
+
 // Helper template to convert PropertyValue union to string
 // Works with both NodeProperty and ConversationProperty
 template<typename TProperty>
@@ -114,6 +131,33 @@ FConversationPropertyRef FConversationRef::GetProperty(int32 PropertyIndex) cons
 	return FConversationPropertyRef(Database, Index, PropertyIndex);
 }
 
+FConversationPropertyRef FConversationRef::FindProperty(FName Name) const
+{
+	GAMESCRIPT_REF_CHECK_VALID(FConversationPropertyRef());
+	const int32 PropertyIndex = Database->FindConversationPropertyIndex(Index, Name);
+	return PropertyIndex != INDEX_NONE ? FConversationPropertyRef(Database, Index, PropertyIndex) : FConversationPropertyRef();
+}
+
+bool FConversationRef::TryGetString(FName Name, FString& OutValue) const
+{
+	return FindProperty(Name).TryGetString(OutValue);
+}
+
+bool FConversationRef::TryGetInt(FName Name, int32& OutValue) const
+{
+	return FindProperty(Name).TryGetInt(OutValue);
+}
+
+bool FConversationRef::TryGetFloat(FName Name, float& OutValue) const
+{
+	return FindProperty(Name).TryGetFloat(OutValue);
+}
+
+bool FConversationRef::TryGetBool(FName Name, bool& OutValue) const
+{
+	return FindProperty(Name).TryGetBool(OutValue);
+}
+
 int32 FConversationRef::GetNodeCount() const
 {
 	GAMESCRIPT_REF_CHECK_VALID(0);
@@ -292,6 +336,33 @@ FNodePropertyRef FNodeRef::GetProperty(int32 PropertyIndex) const
 	return FNodePropertyRef(Database, Index, PropertyIndex);
 }
 
+FNodePropertyRef FNodeRef::FindProperty(FName Name) const
+{
+	GAMESCRIPT_REF_CHECK_VALID(FNodePropertyRef());
+	const int32 PropertyIndex = Database->FindNodePropertyIndex(Index, Name);
+	return PropertyIndex != INDEX_NONE ? FNodePropertyRef(Database, Index, PropertyIndex) : FNodePropertyRef();
+}
+
+bool FNodeRef::TryGetString(FName Name, FString& OutValue) const
+{
+	return FindProperty(Name).TryGetString(OutValue);
+}
+
+bool FNodeRef::TryGetInt(FName Name, int32& OutValue) const
+{
+	return FindProperty(Name).TryGetInt(OutValue);
+}
+
+bool FNodeRef::TryGetFloat(FName Name, float& OutValue) const
+{
+	return FindProperty(Name).TryGetFloat(OutValue);
+}
+
+bool FNodeRef::TryGetBool(FName Name, bool& OutValue) const
+{
+	return FindProperty(Name).TryGetBool(OutValue);
+}
+
 EGSGenderCategory FNodeRef::ResolveStaticGender(
 	const GameScript::Localization* Loc,
 	const GameScript::Snapshot* Snapshot)
@@ -397,9 +468,7 @@ FString FActorRef::GetLocalizedName() const
 		return FString();
 	}
 
-	const GameScript::Localization* Loc = Snapshot->localizations()->Get(LocIdx);
-	EGSGenderCategory Gender = FNodeRef::ResolveStaticGender(Loc, Snapshot);
-	return FVariantResolver::Resolve(Loc, Gender, EGSPluralCategory::Other);
+	return ResolveStaticText(Database, LocIdx);
 }
 
 EGSGrammaticalGender FActorRef::GetGrammaticalGender() const
@@ -464,17 +533,14 @@ bool FLocalizationRef::IsTemplated() const
 int32 FLocalizationRef::GetVariantCount() const
 {
 	GAMESCRIPT_REF_CHECK_VALID(0);
-	GAMESCRIPT_GET_ENTITY(Localization, localizations, Loc);
-	return Loc->variants() ? static_cast<int32>(Loc->variants()->size()) : 0;
+	const GameScript::Localization* Loc = Database->GetLocalizationText(Index);
+	return Loc && Loc->variants() ? static_cast<int32>(Loc->variants()->size()) : 0;
 }
 
 FString FLocalizationRef::GetText() const
 {
 	GAMESCRIPT_REF_CHECK_VALID(FString());
-	GAMESCRIPT_GET_ENTITY(Localization, localizations, Loc);
-
-	EGSGenderCategory Gender = FNodeRef::ResolveStaticGender(Loc, Snapshot);
-	return FVariantResolver::Resolve(Loc, Gender, EGSPluralCategory::Other);
+	return ResolveStaticText(Database, Index);
 }
 
 // --- FChoiceRef ---
@@ -542,6 +608,13 @@ FNodePropertyRef FChoiceRef::GetProperty(int32 PropertyIndex) const
 	return FNodePropertyRef(Database, Index, PropertyIndex);
 }
 
+FNodePropertyRef FChoiceRef::FindProperty(FName Name) const
+{
+	GAMESCRIPT_REF_CHECK_VALID(FNodePropertyRef());
+	const int32 PropertyIndex = Database->FindNodePropertyIndex(Index, Name);
+	return PropertyIndex != INDEX_NONE ? FNodePropertyRef(Database, Index, PropertyIndex) : FNodePropertyRef();
+}
+
 FNodeRef FChoiceRef::GetNode() const
 {
 	GAMESCRIPT_REF_CHECK_VALID(FNodeRef());
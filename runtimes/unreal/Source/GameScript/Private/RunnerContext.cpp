@@ -3,35 +3,59 @@
 #include "GameScriptDatabase.h"
 #include "GameScriptSettings.h"
 #include "GSCompletionHandle.h"
+#include "GSCompletionToken.h"
+#include "IGameScriptNativeListener.h"
+#include "ConversationReplay.h"
 #include "GameScript.h"
 #include "GameplayTasks/DialogueActionTask.h"
 #include "GameplayTasksComponent.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
 
 // Static counter for unique context IDs (matches Unity's s_NextContextId pattern)
-int32 URunnerContext::NextContextId = 1;
+int32 FRunnerContext::NextContextId = 1;
 
-URunnerContext::URunnerContext()
+void FRunnerContext::QueueOnGameThread(TFunction<void(FRunnerContext&)> Callback) const
+{
+	// Weak runner + slot handle instead of a pointer: the slot may be reused (or the runner gone)
+	// before the game thread runs this
+	TWeakObjectPtr<UGameScriptRunner> WeakRunner(Runner);
+	FActiveConversation Conversation = Handle;
+	Async(EAsyncExecution::TaskGraphMainThread, [WeakRunner, Conversation, Callback = MoveTemp(Callback)]()
+	{
+		UGameScriptRunner* StrongRunner = WeakRunner.Get();
+		if (FRunnerContext* Context = StrongRunner ? StrongRunner->ValidateHandle(Conversation) : nullptr)
+		{
+			Callback(*Context);
+		}
+	});
+}
+
+FRunnerContext::FRunnerContext()
 {
 	// Assign unique ID on construction (never changes, stable across pool operations)
 	ContextId = NextContextId++;
 }
 
-void URunnerContext::Initialize(
+void FRunnerContext::Initialize(
 	UGameScriptRunner* InRunner,
+	FActiveConversation InHandle,
 	int32 InConversationId,
 	TScriptInterface<IGameScriptListener> InListener,
 	UGameplayTasksComponent* InTaskOwner)
 {
 	Runner = InRunner;
+	Handle = InHandle;
 	Database = InRunner->GetDatabase();
 	ConversationId = InConversationId;
 	Listener = InListener;
+	IGameScriptListener* ListenerInterface = InListener.GetInterface();
+	NativeListener = ListenerInterface ? ListenerInterface->GetNativeListener() : nullptr;
 	TaskOwner = InTaskOwner;
 	bIsActive = false;
 	CurrentState = EState::Idle;
 	CurrentEventID = 0;
-	Sequence++;
+	bAwaitingListener = false;
 	ActiveTask = nullptr;
 	PendingHandle = nullptr;
 	bActionCompleted = false;
@@ -44,6 +68,11 @@ void URunnerContext::Initialize(
 	// Reset node tracking
 	CurrentNode = FNodeRef();
 	NodeToExit = FNodeRef();
+	ResumeNode = FNodeRef();
+	bResumeAtDecision = false;
+	ResumeFingerprint = 0;
+	bChoicesSpeculated = false;
+	SpeculativeConditions.Reset();
 
 	// Reset choice arrays (Reset keeps capacity, avoids reallocation)
 	// Reserve on first use only (when slack is 0)
@@ -63,25 +92,61 @@ void URunnerContext::Initialize(
 	bIsCancelled.store(false, std::memory_order_relaxed);
 }
 
-void URunnerContext::Start()
+void FRunnerContext::SetResumePoint(FNodeRef Node, bool bAtDecision, int32 ExpectedFingerprint)
+{
+	ResumeNode = Node;
+	bResumeAtDecision = bAtDecision;
+	ResumeFingerprint = ExpectedFingerprint;
+}
+
+void FRunnerContext::Start()
 {
 	bIsActive = true;
 	TransitionTo(EState::ConversationEnter);
 }
 
-void URunnerContext::Cancel()
+bool FRunnerContext::Save(FGSConversationSave& OutSave) const
+{
+	OutSave = FGSConversationSave();
+	OutSave.ConversationId = ConversationId;
+
+	switch (CurrentState)
+	{
+	case EState::ConversationEnter:
+	case EState::NodeEnter:
+	case EState::ActionAndSpeech:
+		// Restart the node being played
+		OutSave.NodeId = CurrentNode.IsValid() ? CurrentNode.GetId() : -1;
+		break;
+
+	case EState::EvaluateEdges:
+		// Waiting on OnDecision (edge evaluation is otherwise synchronous)
+		OutSave.NodeId = CurrentNode.IsValid() ? CurrentNode.GetId() : -1;
+		OutSave.ResumePoint = EGSConversationResumePoint::Decision;
+		OutSave.ChoiceFingerprint = GetChoiceFingerprint();
+		break;
+
+	case EState::NodeExit:
+		// The next node is already chosen; invalid when the conversation is ending
+		OutSave.NodeId = CurrentNode.IsValid() ? CurrentNode.GetId() : -1;
+		break;
+
+	default:
+		break;
+	}
+
+	return OutSave.IsValid();
+}
+
+void FRunnerContext::Cancel()
 {
 	// Ensure we're on the game thread for thread safety
 	if (!IsInGameThread())
 	{
 		// Queue to game thread to prevent race conditions with listener callbacks
-		TWeakObjectPtr<URunnerContext> WeakThis(this);
-		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis]()
+		QueueOnGameThread([](FRunnerContext& Context)
 		{
-			if (URunnerContext* StrongThis = WeakThis.Get())
-			{
-				StrongThis->Cancel();
-			}
+			Context.Cancel();
 		});
 		return;
 	}
@@ -97,6 +162,7 @@ void URunnerContext::Cancel()
 		Runner->ReleaseHandle(PendingHandle);
 		PendingHandle = nullptr;
 	}
+	bAwaitingListener = false;
 
 	// Cancel active task
 	if (ActiveTask)
@@ -112,32 +178,26 @@ void URunnerContext::Cancel()
 	TransitionTo(EState::CancellationCleanup);
 }
 
-void URunnerContext::OnListenerReady(int32 ContextID)
+void FRunnerContext::OnListenerReady(int32 ContextID)
 {
 	// Ensure we're on the game thread
 	if (!IsInGameThread())
 	{
 		// Queue to game thread to ensure thread safety
-		// Use weak pointer to prevent dangling pointer if context is destroyed before callback executes
-		TWeakObjectPtr<URunnerContext> WeakThis(this);
-		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, ContextID]()
+		QueueOnGameThread([ContextID](FRunnerContext& Context)
 		{
-			URunnerContext* StrongThis = WeakThis.Get();
-
-			if (StrongThis)
-			{
-				StrongThis->OnListenerReady(ContextID);
-			}
+			Context.OnListenerReady(ContextID);
 		});
 		return;
 	}
 
-	// Validate context ID
-	if (ContextID != CurrentEventID)
+	// Validate context ID (and that no earlier copy of a token already completed it)
+	if (!IsAwaitingListener(ContextID))
 	{
 		// Ignore stale completion
 		return;
 	}
+	bAwaitingListener = false;
 
 	// Release handle back to pool (it's been used successfully)
 	if (PendingHandle)
@@ -150,8 +210,8 @@ void URunnerContext::OnListenerReady(int32 ContextID)
 	switch (CurrentState)
 	{
 	case EState::ConversationEnter:
-		// Root nodes skip directly to edge evaluation (matches Unity behavior)
-		if (CurrentNode.IsValid() && CurrentNode.GetType() == ENodeType::Root)
+		// Root nodes and resumed decisions skip directly to edge evaluation (matches Unity behavior)
+		if (CurrentNode.IsValid() && (bResumeAtDecision || CurrentNode.GetType() == ENodeType::Root))
 		{
 			TransitionTo(EState::EvaluateEdges);
 		}
@@ -208,32 +268,26 @@ void URunnerContext::OnListenerReady(int32 ContextID)
 	}
 }
 
-void URunnerContext::OnListenerChoice(FNodeRef Choice, int32 ContextID)
+void FRunnerContext::OnListenerChoice(FNodeRef Choice, int32 ContextID)
 {
 	// Ensure we're on the game thread
 	if (!IsInGameThread())
 	{
 		// Queue to game thread to ensure thread safety
-		// Use weak pointer to prevent dangling pointer if context is destroyed before callback executes
-		TWeakObjectPtr<URunnerContext> WeakThis(this);
-		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, Choice, ContextID]()
+		QueueOnGameThread([Choice, ContextID](FRunnerContext& Context)
 		{
-			URunnerContext* StrongThis = WeakThis.Get();
-
-			if (StrongThis)
-			{
-				StrongThis->OnListenerChoice(Choice, ContextID);
-			}
+			Context.OnListenerChoice(Choice, ContextID);
 		});
 		return;
 	}
 
-	// Validate context ID
-	if (ContextID != CurrentEventID)
+	// Validate context ID (and that no earlier copy of a token already completed it)
+	if (!IsAwaitingListener(ContextID))
 	{
 		// Ignore stale completion
 		return;
 	}
+	bAwaitingListener = false;
 
 	// Release handle back to pool (it's been used successfully)
 	if (PendingHandle)
@@ -264,37 +318,33 @@ void URunnerContext::OnListenerChoice(FNodeRef Choice, int32 ContextID)
 
 	// Set current node to selected choice (NodeToExit was already stored in EnterEvaluateEdges)
 	CurrentNode = Choice;
+	Runner->GetRecorder().Record(EGSRecordedEvent::Choice, ContextId, Choice.GetId(),
+		ValidChoices.IndexOfByPredicate([&Choice](const FChoiceRef& ValidChoice) { return ValidChoice.Index == Choice.Index; }));
 
 	// Proceed to node exit
 	TransitionTo(EState::NodeExit);
 }
 
-void URunnerContext::OnListenerChoiceByIndex(int32 ChoiceIndex, int32 ContextID)
+void FRunnerContext::OnListenerChoiceByIndex(int32 ChoiceIndex, int32 ContextID)
 {
 	// Ensure we're on the game thread
 	if (!IsInGameThread())
 	{
 		// Queue to game thread to ensure thread safety
-		// Use weak pointer to prevent dangling pointer if context is destroyed before callback executes
-		TWeakObjectPtr<URunnerContext> WeakThis(this);
-		Async(EAsyncExecution::TaskGraphMainThread, [WeakThis, ChoiceIndex, ContextID]()
+		QueueOnGameThread([ChoiceIndex, ContextID](FRunnerContext& Context)
 		{
-			URunnerContext* StrongThis = WeakThis.Get();
-
-			if (StrongThis)
-			{
-				StrongThis->OnListenerChoiceByIndex(ChoiceIndex, ContextID);
-			}
+			Context.OnListenerChoiceByIndex(ChoiceIndex, ContextID);
 		});
 		return;
 	}
 
-	// Validate context ID
-	if (ContextID != CurrentEventID)
+	// Validate context ID (and that no earlier copy of a token already completed it)
+	if (!IsAwaitingListener(ContextID))
 	{
 		// Ignore stale completion
 		return;
 	}
+	bAwaitingListener = false;
 
 	// Release handle back to pool (it's been used successfully)
 	if (PendingHandle)
@@ -314,59 +364,124 @@ void URunnerContext::OnListenerChoiceByIndex(int32 ChoiceIndex, int32 ContextID)
 
 	// Set current node to selected choice
 	CurrentNode = FNodeRef(Database, ValidChoices[ChoiceIndex].Index);
+	Runner->GetRecorder().Record(EGSRecordedEvent::Choice, ContextId, CurrentNode.GetId(), ChoiceIndex);
 
 	// Proceed to node exit
 	TransitionTo(EState::NodeExit);
 }
 
+// --- Runtime Hot Reload ---
+
+void FRunnerContext::CaptureNodeIds()
+{
+	// Speculative choices were evaluated against the old snapshot
+	bChoicesSpeculated = false;
+	SpeculativeConditions.Reset();
+
+	CapturedNodeId = CurrentNode.IsValid() ? CurrentNode.GetId() : -1;
+	CapturedNodeToExitId = NodeToExit.IsValid() ? NodeToExit.GetId() : -1;
+
+	CapturedChoiceIds.Reset();
+	for (const FChoiceRef& Choice : ValidChoices)
+	{
+		CapturedChoiceIds.Add(Choice.GetId());
+	}
+
+	CapturedHighestPriorityIds.Reset();
+	for (const FChoiceRef& Choice : HighestPriorityChoices)
+	{
+		CapturedHighestPriorityIds.Add(Choice.GetId());
+	}
+}
+
+bool FRunnerContext::RemapNodeIds()
+{
+	bool bComplete = Database->FindConversation(ConversationId).IsValid();
+
+	auto RemapNode = [this, &bComplete](int32 NodeId, FNodeRef& OutNode)
+	{
+		OutNode = NodeId >= 0 ? Database->FindNode(NodeId) : FNodeRef();
+		bComplete &= NodeId < 0 || OutNode.IsValid();
+	};
+
+	// Choices keep their pre-resolved text (already on screen)
+	auto RemapChoices = [this, &bComplete](const TArray<int32>& NodeIds, TArray<FChoiceRef>& Choices)
+	{
+		check(NodeIds.Num() == Choices.Num());
+		for (int32 i = 0; i < Choices.Num(); ++i)
+		{
+			FNodeRef Node = Database->FindNode(NodeIds[i]);
+			bComplete &= Node.IsValid();
+			Choices[i] = FChoiceRef(Database, Node.Index, Choices[i].ResolvedUIResponseText);
+		}
+	};
+
+	RemapNode(CapturedNodeId, CurrentNode);
+	RemapNode(CapturedNodeToExitId, NodeToExit);
+	RemapChoices(CapturedChoiceIds, ValidChoices);
+	RemapChoices(CapturedHighestPriorityIds, HighestPriorityChoices);
+
+	// Cleanup states no longer read nodes; let them finish normally
+	switch (CurrentState)
+	{
+	case EState::ConversationExit:
+	case EState::CancellationCleanup:
+	case EState::ErrorCleanup:
+	case EState::FinalCleanup:
+		return true;
+	default:
+		return bComplete;
+	}
+}
+
 // --- IDialogueContext Implementation ---
 
-bool URunnerContext::IsCancelled() const
+bool FRunnerContext::IsCancelled() const
 {
 	return bIsCancelled.load(std::memory_order_acquire);
 }
 
-int32 URunnerContext::GetNodeId() const
+int32 FRunnerContext::GetNodeId() const
 {
 	return CurrentNode.IsValid() ? CurrentNode.GetId() : -1;
 }
 
-int32 URunnerContext::GetConversationId() const
+int32 FRunnerContext::GetConversationId() const
 {
 	return ConversationId;
 }
 
-FActorRef URunnerContext::GetActor() const
+FActorRef FRunnerContext::GetActor() const
 {
 	return CurrentNode.IsValid() ? CurrentNode.GetActor() : FActorRef();
 }
 
-FString URunnerContext::GetVoiceText() const
+FString FRunnerContext::GetVoiceText() const
 {
 	return CachedVoiceText;
 }
 
-FString URunnerContext::GetUIResponseText() const
+FString FRunnerContext::GetUIResponseText() const
 {
 	return CachedUIResponseText;
 }
 
-int32 URunnerContext::GetVoiceTextLocalizationIdx() const
+int32 FRunnerContext::GetVoiceTextLocalizationIdx() const
 {
 	return CurrentNode.IsValid() ? CurrentNode.GetVoiceTextLocalizationIdx() : -1;
 }
 
-int32 URunnerContext::GetUIResponseTextLocalizationIdx() const
+int32 FRunnerContext::GetUIResponseTextLocalizationIdx() const
 {
 	return CurrentNode.IsValid() ? CurrentNode.GetUIResponseTextLocalizationIdx() : -1;
 }
 
-int32 URunnerContext::GetPropertyCount() const
+int32 FRunnerContext::GetPropertyCount() const
 {
 	return CurrentNode.IsValid() ? CurrentNode.GetPropertyCount() : 0;
 }
 
-FNodePropertyRef URunnerContext::GetProperty(int32 Index) const
+FNodePropertyRef FRunnerContext::GetProperty(int32 Index) const
 {
 	if (!CurrentNode.IsValid())
 	{
@@ -382,14 +497,19 @@ FNodePropertyRef URunnerContext::GetProperty(int32 Index) const
 	return FNodePropertyRef(CurrentNode.Database, CurrentNode.Index, Index);
 }
 
-UGameplayTasksComponent* URunnerContext::GetTaskOwner() const
+FNodePropertyRef FRunnerContext::FindProperty(FName Name) const
+{
+	return CurrentNode.IsValid() ? CurrentNode.FindProperty(Name) : FNodePropertyRef();
+}
+
+UGameplayTasksComponent* FRunnerContext::GetTaskOwner() const
 {
 	return TaskOwner.Get();
 }
 
 // --- State Machine Methods ---
 
-void URunnerContext::EnterConversationEnter()
+void FRunnerContext::EnterConversationEnter()
 {
 	FConversationRef Conv = Database->FindConversation(ConversationId);
 	if (!Conv.IsValid())
@@ -400,8 +520,8 @@ void URunnerContext::EnterConversationEnter()
 		return;
 	}
 
-	// Get root node
-	CurrentNode = Conv.GetRootNode();
+	// Get root node (or the resume point)
+	CurrentNode = ResumeNode.IsValid() ? ResumeNode : Conv.GetRootNode();
 	if (!CurrentNode.IsValid())
 	{
 		PendingErrorMessage = FString::Printf(TEXT("Conversation %d has no root node"), ConversationId);
@@ -410,14 +530,19 @@ void URunnerContext::EnterConversationEnter()
 		return;
 	}
 
-	// Acquire handle from pool and call listener
+	// Call listener (native listeners get a token, Blueprint listeners a pooled handle)
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
-	IGameScriptListener::Execute_OnConversationEnter(Listener.GetObject(), Conv, PendingHandle);
+	if (NativeListener)
+	{
+		NativeListener->OnConversationEnter(Conv, MakeToken(ContextID));
+	}
+	else
+	{
+		IGameScriptListener::Execute_OnConversationEnter(Listener.GetObject(), Conv, AcquirePendingHandle(ContextID));
+	}
 }
 
-void URunnerContext::EnterNodeEnter()
+void FRunnerContext::EnterNodeEnter()
 {
 	if (!CurrentNode.IsValid())
 	{
@@ -430,14 +555,25 @@ void URunnerContext::EnterNodeEnter()
 	// Resolve and cache voice/UI response text for this node before listener callback
 	CacheNodeTexts();
 
-	// Acquire handle from pool and call listener
+	// Resolve the next lines on a worker while this one plays
+	if (!Replay)
+	{
+		TextPrefetch.Prefetch(Runner, Listener.GetObject(), NativeListener, CurrentNode, Runner->GetSettings()->LookAheadDepth);
+	}
+
+	// Call listener
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
-	IGameScriptListener::Execute_OnNodeEnter(Listener.GetObject(), CurrentNode, PendingHandle);
+	if (NativeListener)
+	{
+		NativeListener->OnNodeEnter(CurrentNode, MakeToken(ContextID));
+	}
+	else
+	{
+		IGameScriptListener::Execute_OnNodeEnter(Listener.GetObject(), CurrentNode, AcquirePendingHandle(ContextID));
+	}
 }
 
-void URunnerContext::EnterActionAndSpeech()
+void FRunnerContext::EnterActionAndSpeech()
 {
 	if (!CurrentNode.IsValid())
 	{
@@ -448,6 +584,7 @@ void URunnerContext::EnterActionAndSpeech()
 	// Reset tracking for concurrent completion
 	bActionCompleted = false;
 	bSpeechCompleted = false;
+	const int32 Serial = ++ActionAndSpeechSerial;
 
 	ENodeType NodeType = CurrentNode.GetType();
 	bool bHasAction = CurrentNode.HasAction();
@@ -461,10 +598,7 @@ void URunnerContext::EnterActionAndSpeech()
 		ExecuteAction(CurrentNode);
 
 		// Fire speech immediately (don't wait for action)
-		int32 ContextID = GenerateContextID();
-		PendingHandle = Runner->AcquireHandle();
-		PendingHandle->Initialize(this, ContextID);
-		IGameScriptListener::Execute_OnSpeech(Listener.GetObject(), CurrentNode, CachedVoiceText, PendingHandle);
+		FireSpeech();
 	}
 	else if (bHasAction)
 	{
@@ -476,22 +610,46 @@ void URunnerContext::EnterActionAndSpeech()
 	{
 		// Dialogue node without action: speech only
 		bActionCompleted = true;  // Mark action as "done" (not needed)
-		int32 ContextID = GenerateContextID();
-		PendingHandle = Runner->AcquireHandle();
-		PendingHandle->Initialize(this, ContextID);
-		IGameScriptListener::Execute_OnSpeech(Listener.GetObject(), CurrentNode, CachedVoiceText, PendingHandle);
+		FireSpeech();
 	}
 	else
 	{
 		// Logic/Root node without action: skip to edges
 		TransitionTo(EState::EvaluateEdges);
+		return;
+	}
+
+	// Still waiting on this node's speech (listeners may complete synchronously): build the
+	// choices now so the decision is ready when it finishes. Not while a latent action is in
+	// flight - it may change what any condition reads, volatile or not
+	if (CurrentState == EState::ActionAndSpeech && Serial == ActionAndSpeechSerial && bActionCompleted
+		&& !Replay && Runner->GetSettings()->bSpeculativeChoices)
+	{
+		FindValidChoices(true);
+		bChoicesSpeculated = true;
 	}
 }
 
-void URunnerContext::EnterEvaluateEdges()
+void FRunnerContext::EnterEvaluateEdges()
 {
-	// Find valid choices
-	FindValidChoices();
+	// Find valid choices (unless built while the action/speech played and still valid)
+	if (!bChoicesSpeculated || !ReuseSpeculativeChoices())
+	{
+		FindValidChoices();
+	}
+	bChoicesSpeculated = false;
+
+	// Resumed decision: conditions may read game state that changed since the save
+	if (bResumeAtDecision)
+	{
+		bResumeAtDecision = false;
+		if (GetChoiceFingerprint() != ResumeFingerprint)
+		{
+			UE_LOG(LogGameScript, Warning,
+				TEXT("Restored decision at node %d offers different choices than when saved - using current choices"),
+				CurrentNode.GetId());
+		}
+	}
 
 	if (ValidChoices.Num() == 0)
 	{
@@ -536,9 +694,14 @@ void URunnerContext::EnterEvaluateEdges()
 
 		// Player choice required: Call OnDecision
 		int32 ContextID = GenerateContextID();
-		PendingHandle = Runner->AcquireHandle();
-		PendingHandle->Initialize(this, ContextID);
-		IGameScriptListener::Execute_OnDecision(Listener.GetObject(), ValidChoices, PendingHandle);
+		if (NativeListener)
+		{
+			NativeListener->OnDecision(ValidChoices, MakeToken(ContextID));
+		}
+		else
+		{
+			IGameScriptListener::Execute_OnDecision(Listener.GetObject(), ValidChoices, AcquirePendingHandle(ContextID));
+		}
 		// Wait for listener to call SelectChoice() or SelectChoiceByIndex()
 	}
 	else
@@ -547,8 +710,9 @@ void URunnerContext::EnterEvaluateEdges()
 		NodeToExit = CurrentNode;
 
 		// Auto-advance: Call OnAutoDecision with highest-priority choices (matches Unity)
-		FChoiceRef SelectedChoice = IGameScriptListener::Execute_OnAutoDecision(
-			Listener.GetObject(), HighestPriorityChoices);
+		FChoiceRef SelectedChoice = NativeListener
+			? NativeListener->OnAutoDecision(HighestPriorityChoices)
+			: IGameScriptListener::Execute_OnAutoDecision(Listener.GetObject(), HighestPriorityChoices);
 
 		// Validate that returned choice is in valid choices (not just IsValid)
 		bool bFoundInChoices = false;
@@ -576,12 +740,13 @@ void URunnerContext::EnterEvaluateEdges()
 		}
 
 		CurrentNode = FNodeRef(Database, SelectedChoice.Index);
+		Runner->GetRecorder().Record(EGSRecordedEvent::Choice, ContextId, CurrentNode.GetId(), -1);
 
 		TransitionTo(EState::NodeExit);
 	}
 }
 
-void URunnerContext::EnterNodeExit()
+void FRunnerContext::EnterNodeExit()
 {
 	// Use NodeToExit which was stored before advancing to the next node
 	// This ensures OnNodeExit receives the node being exited, not the next node
@@ -600,36 +765,48 @@ void URunnerContext::EnterNodeExit()
 		return;
 	}
 
-	// Acquire handle from pool and call listener
+	// Call listener
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
-	IGameScriptListener::Execute_OnNodeExit(Listener.GetObject(), NodeToExit, PendingHandle);
+	if (NativeListener)
+	{
+		NativeListener->OnNodeExit(NodeToExit, MakeToken(ContextID));
+	}
+	else
+	{
+		IGameScriptListener::Execute_OnNodeExit(Listener.GetObject(), NodeToExit, AcquirePendingHandle(ContextID));
+	}
 }
 
-void URunnerContext::EnterConversationExit()
+void FRunnerContext::EnterConversationExit()
 {
 	FConversationRef Conv = Database->FindConversation(ConversationId);
 
-	// Acquire handle from pool and call listener
+	// Call listener
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
-	IGameScriptListener::Execute_OnConversationExit(Listener.GetObject(), Conv, PendingHandle);
+	if (NativeListener)
+	{
+		NativeListener->OnConversationExit(Conv, MakeToken(ContextID));
+	}
+	else
+	{
+		IGameScriptListener::Execute_OnConversationExit(Listener.GetObject(), Conv, AcquirePendingHandle(ContextID));
+	}
 }
 
-void URunnerContext::EnterCancellationCleanup()
+void FRunnerContext::EnterCancellationCleanup()
 {
 	FConversationRef Conv = Database->FindConversation(ConversationId);
 
-	// Acquire handle from pool and call listener (async cleanup)
+	// Call listener (async cleanup)
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
 	UObject* ListenerObj = Listener.GetObject();
-	if (ListenerObj)
+	if (NativeListener && ListenerObj)
+	{
+		NativeListener->OnConversationCancelled(Conv, MakeToken(ContextID));
+	}
+	else if (ListenerObj)
 	{
-		IGameScriptListener::Execute_OnConversationCancelled(ListenerObj, Conv, PendingHandle);
+		IGameScriptListener::Execute_OnConversationCancelled(ListenerObj, Conv, AcquirePendingHandle(ContextID));
 	}
 	else
 	{
@@ -638,18 +815,20 @@ void URunnerContext::EnterCancellationCleanup()
 	}
 }
 
-void URunnerContext::EnterErrorCleanup()
+void FRunnerContext::EnterErrorCleanup()
 {
 	FConversationRef Conv = Database->FindConversation(ConversationId);
 
-	// Acquire handle from pool and call listener (async error handling)
+	// Call listener (async error handling)
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
 	UObject* ListenerObj = Listener.GetObject();
-	if (ListenerObj)
+	if (NativeListener && ListenerObj)
+	{
+		NativeListener->OnError(Conv, PendingErrorMessage, MakeToken(ContextID));
+	}
+	else if (ListenerObj)
 	{
-		IGameScriptListener::Execute_OnError(ListenerObj, Conv, PendingErrorMessage, PendingHandle);
+		IGameScriptListener::Execute_OnError(ListenerObj, Conv, PendingErrorMessage, AcquirePendingHandle(ContextID));
 	}
 	else
 	{
@@ -658,18 +837,20 @@ void URunnerContext::EnterErrorCleanup()
 	}
 }
 
-void URunnerContext::EnterFinalCleanup()
+void FRunnerContext::EnterFinalCleanup()
 {
 	FConversationRef Conv = Database->FindConversation(ConversationId);
 
-	// Acquire handle from pool and call listener (async final cleanup)
+	// Call listener (async final cleanup)
 	int32 ContextID = GenerateContextID();
-	PendingHandle = Runner->AcquireHandle();
-	PendingHandle->Initialize(this, ContextID);
 	UObject* ListenerObj = Listener.GetObject();
-	if (ListenerObj)
+	if (NativeListener && ListenerObj)
+	{
+		NativeListener->OnCleanup(Conv, MakeToken(ContextID));
+	}
+	else if (ListenerObj)
 	{
-		IGameScriptListener::Execute_OnCleanup(ListenerObj, Conv, PendingHandle);
+		IGameScriptListener::Execute_OnCleanup(ListenerObj, Conv, AcquirePendingHandle(ContextID));
 	}
 	else
 	{
@@ -678,7 +859,7 @@ void URunnerContext::EnterFinalCleanup()
 	}
 }
 
-void URunnerContext::EnterIdle()
+void FRunnerContext::EnterIdle()
 {
 	// Release any pending handle back to pool
 	if (PendingHandle)
@@ -686,6 +867,7 @@ void URunnerContext::EnterIdle()
 		Runner->ReleaseHandle(PendingHandle);
 		PendingHandle = nullptr;
 	}
+	ActiveTask = nullptr;
 
 	// Note: bIsCancelled is reset in Initialize() when context is reused
 
@@ -700,31 +882,38 @@ void URunnerContext::EnterIdle()
 	// Reset choice arrays (Reset keeps capacity for reuse)
 	ValidChoices.Reset();
 	HighestPriorityChoices.Reset();
+	bChoicesSpeculated = false;
+	SpeculativeConditions.Reset();
+	TextPrefetch.Reset();
 
 	// Clear error message
 	PendingErrorMessage = FString();
 
 	// Clear listener reference
 	Listener = nullptr;
+	NativeListener = nullptr;
 
 	// Mark inactive
 	bIsActive = false;
 	CurrentState = EState::Idle;
+	Replay.Reset();
 
 	// Return context to pool (must be last - context may be reused immediately)
 	// This matches Unity's behavior where the finally block releases the context
 	if (Runner)
 	{
+		Runner->GetRecorder().Record(EGSRecordedEvent::State, ContextId, -1, static_cast<int32>(EState::Idle));
 		Runner->ReleaseContext(this);
 	}
 }
 
-void URunnerContext::TransitionTo(EState NewState)
+void FRunnerContext::TransitionTo(EState NewState)
 {
 	// State machine must always run on game thread for thread safety
 	check(IsInGameThread());
 
 	CurrentState = NewState;
+	Runner->GetRecorder().Record(EGSRecordedEvent::State, ContextId, CurrentNode.IsValid() ? CurrentNode.GetId() : -1, static_cast<int32>(NewState));
 
 	switch (NewState)
 	{
@@ -760,7 +949,7 @@ void URunnerContext::TransitionTo(EState NewState)
 	}
 }
 
-void URunnerContext::OnActionCompleted()
+void FRunnerContext::OnActionCompleted()
 {
 	ActiveTask = nullptr;
 
@@ -769,15 +958,16 @@ void URunnerContext::OnActionCompleted()
 	CheckActionAndSpeechComplete();
 }
 
-void URunnerContext::OnActionCancelled()
+void FRunnerContext::OnActionCancelled()
 {
 	ActiveTask = nullptr;
 	// Cancellation already handled by Cancel()
 }
 
-void URunnerContext::ExecuteAction(FNodeRef Node)
+void FRunnerContext::ExecuteAction(FNodeRef Node)
 {
-	if (!Node.IsValid())
+	// Replays reproduce the path only; game-side effects are not re-run
+	if (!Node.IsValid() || Replay)
 	{
 		OnActionCompleted();
 		return;
@@ -817,9 +1007,21 @@ void URunnerContext::ExecuteAction(FNodeRef Node)
 			UDialogueActionTask* DialogueTask = Cast<UDialogueActionTask>(Task);
 			if (DialogueTask)
 			{
-				// Latent action - wait for completion
-				DialogueTask->GetOnCompleted().AddDynamic(this, &URunnerContext::OnActionCompleted);
-				DialogueTask->GetOnCancelled().AddDynamic(this, &URunnerContext::OnActionCancelled);
+				// Latent action - wait for completion (the task may outlive this conversation)
+				DialogueTask->GetOnCompletedNative().AddWeakLambda(Runner, [this, Conversation = Handle]()
+				{
+					if (Runner->ValidateHandle(Conversation) == this)
+					{
+						OnActionCompleted();
+					}
+				});
+				DialogueTask->GetOnCancelledNative().AddWeakLambda(Runner, [this, Conversation = Handle]()
+				{
+					if (Runner->ValidateHandle(Conversation) == this)
+					{
+						OnActionCancelled();
+					}
+				});
 				DialogueTask->ReadyForActivation();
 				ActiveTask = DialogueTask;
 			}
@@ -847,7 +1049,7 @@ void URunnerContext::ExecuteAction(FNodeRef Node)
 	}
 }
 
-bool URunnerContext::EvaluateCondition(FNodeRef Node)
+bool FRunnerContext::EvaluateCondition(FNodeRef Node)
 {
 	if (!Node.IsValid())
 	{
@@ -891,8 +1093,58 @@ bool URunnerContext::EvaluateCondition(FNodeRef Node)
 	return bResult;
 }
 
-void URunnerContext::FindValidChoices()
+FNodePropertyRef FGSConditionContext::GetProperty(int32 Index) const
+{
+	if (Index < 0 || Index >= Node.GetPropertyCount())
+	{
+		return FNodePropertyRef();
+	}
+	return FNodePropertyRef(Node.Database, Node.Index, Index);
+}
+
+void FRunnerContext::EvaluateConditionsInParallel(int32 EdgeCount)
+{
+	ParallelConditionResults.Reset();
+
+	// Replays take recorded results; small fan-outs are cheaper on the game thread
+	const UGameScriptSettings* Settings = Runner->GetSettings();
+	if (Replay || !Settings || !Settings->bParallelConditions || EdgeCount < Settings->ParallelConditionThreshold)
+	{
+		return;
+	}
+
+	const TArray<ConditionDelegate>& Conditions = Runner->GetConditions();
+	ParallelConditions.Reset();
+	for (int32 i = 0; i < EdgeCount; ++i)
+	{
+		FEdgeRef Edge = CurrentNode.GetOutgoingEdge(i);
+		FNodeRef Target = Edge.IsValid() ? Edge.GetTarget() : FNodeRef();
+		if (Target.IsValid() && Target.HasCondition() && Runner->IsConditionThreadSafe(Target.Index)
+			&& Conditions.IsValidIndex(Target.Index) && Conditions[Target.Index])
+		{
+			ParallelConditions.Add({i, Target});
+		}
+	}
+	if (ParallelConditions.Num() < Settings->ParallelConditionThreshold)
+	{
+		return;
+	}
+
+	// Each task writes only its own edge's slot; FindValidChoices consumes them in edge order
+	ParallelConditionResults.Init(-1, EdgeCount);
+	UGameplayTasksComponent* Owner = TaskOwner.Get();
+	ParallelFor(ParallelConditions.Num(), [this, Owner, &Conditions](int32 Idx)
+	{
+		const FParallelCondition& Condition = ParallelConditions[Idx];
+		const FGSConditionContext View(this, Condition.Target, Owner);
+		ParallelConditionResults[Condition.EdgeIndex] = Conditions[Condition.Target.Index](&View) ? 1 : 0;
+	});
+}
+
+void FRunnerContext::FindValidChoices(bool bSpeculative)
 {
+	SpeculativeConditions.Reset();
+
 	if (!CurrentNode.IsValid())
 	{
 		ValidChoices.Reset();
@@ -914,6 +1166,9 @@ void URunnerContext::FindValidChoices()
 	bAllChoicesSameActor = true;
 	int32 FirstActorId = -1;
 
+	// Thread-safe conditions of high fan-out nodes run on workers first
+	EvaluateConditionsInParallel(EdgeCount);
+
 	// Iterate through outgoing edges (already sorted by priority in snapshot)
 	for (int32 i = 0; i < EdgeCount; ++i)
 	{
@@ -929,10 +1184,23 @@ void URunnerContext::FindValidChoices()
 			continue;
 		}
 
-		// Check condition if present
+		// Check condition if present (replays use the recorded result)
+		// Speculative results are recorded only once they are used, so recordings match either way
 		if (Target.HasCondition())
 		{
-			if (!EvaluateCondition(Target))
+			const int8 ParallelResult = ParallelConditionResults.IsValidIndex(i) ? ParallelConditionResults[i] : -1;
+			const bool bPassed = Replay ? Replay->NextCondition(Target.GetId())
+				: ParallelResult >= 0 ? ParallelResult != 0
+				: EvaluateCondition(Target);
+			if (bSpeculative)
+			{
+				SpeculativeConditions.Add({Target, bPassed, Runner->IsConditionVolatile(Target.Index)});
+			}
+			else
+			{
+				Runner->GetRecorder().Record(EGSRecordedEvent::Condition, ContextId, Target.GetId(), bPassed ? 1 : 0);
+			}
+			if (!bPassed)
 			{
 				continue;
 			}
@@ -943,10 +1211,11 @@ void URunnerContext::FindValidChoices()
 		int32 UIIdx = Target.GetUIResponseTextLocalizationIdx();
 		if (UIIdx >= 0)
 		{
-			FLocalizationRef LocRef(Database, UIIdx);
-			FTextResolutionParams ChoiceParams = IGameScriptListener::Execute_OnDecisionParams(
-				Listener.GetObject(), LocRef, Target);
-			ResolvedChoiceText = Runner->ResolveText(UIIdx, Target, ChoiceParams);
+			FTextResolutionParams ChoiceParams = GetDecisionParams(Target, UIIdx);
+			if (!TextPrefetch.FindUIResponseText(Target, ChoiceParams, ResolvedChoiceText))
+			{
+				ResolvedChoiceText = Runner->ResolveText(UIIdx, Target, ChoiceParams);
+			}
 		}
 
 		FChoiceRef TargetChoice(Database, Target.Index, ResolvedChoiceText);
@@ -981,7 +1250,38 @@ void URunnerContext::FindValidChoices()
 	}
 }
 
-void URunnerContext::CacheNodeTexts()
+bool FRunnerContext::ReuseSpeculativeChoices()
+{
+	// Non-volatile results are trusted; any changed volatile result rebuilds every choice
+	for (const FSpeculativeCondition& Condition : SpeculativeConditions)
+	{
+		if (Condition.bVolatile && EvaluateCondition(Condition.Target) != Condition.bPassed)
+		{
+			return false;
+		}
+	}
+
+	FGSConversationRecorder& Recorder = Runner->GetRecorder();
+	for (const FSpeculativeCondition& Condition : SpeculativeConditions)
+	{
+		Recorder.Record(EGSRecordedEvent::Condition, ContextId, Condition.Target.GetId(), Condition.bPassed ? 1 : 0);
+	}
+	SpeculativeConditions.Reset();
+	return true;
+}
+
+int32 FRunnerContext::GetChoiceFingerprint() const
+{
+	// Order-sensitive: choices are presented in edge order
+	uint32 Fingerprint = 0;
+	for (const FChoiceRef& Choice : ValidChoices)
+	{
+		Fingerprint = HashCombine(Fingerprint, GetTypeHash(Choice.GetId()));
+	}
+	return static_cast<int32>(Fingerprint);
+}
+
+void FRunnerContext::CacheNodeTexts()
 {
 	if (!CurrentNode.IsValid())
 	{
@@ -994,10 +1294,11 @@ void URunnerContext::CacheNodeTexts()
 	int32 VoiceIdx = CurrentNode.GetVoiceTextLocalizationIdx();
 	if (VoiceIdx >= 0)
 	{
-		FLocalizationRef LocRef(Database, VoiceIdx);
-		FTextResolutionParams SpeechParams = IGameScriptListener::Execute_OnSpeechParams(
-			Listener.GetObject(), LocRef, CurrentNode);
-		CachedVoiceText = Runner->ResolveText(VoiceIdx, CurrentNode, SpeechParams);
+		FTextResolutionParams SpeechParams = GetSpeechParams(CurrentNode, VoiceIdx);
+		if (!TextPrefetch.FindVoiceText(CurrentNode, SpeechParams, CachedVoiceText))
+		{
+			CachedVoiceText = Runner->ResolveText(VoiceIdx, CurrentNode, SpeechParams);
+		}
 	}
 	else
 	{
@@ -1017,12 +1318,54 @@ void URunnerContext::CacheNodeTexts()
 	}
 }
 
-int32 URunnerContext::GenerateContextID()
+FTextResolutionParams FRunnerContext::GetSpeechParams(FNodeRef Node, int32 LocalizationIdx) const
+{
+	const FLocalizationRef LocRef(Database, LocalizationIdx);
+	return NativeListener
+		? NativeListener->OnSpeechParams(LocRef, Node)
+		: IGameScriptListener::Execute_OnSpeechParams(Listener.GetObject(), LocRef, Node);
+}
+
+FTextResolutionParams FRunnerContext::GetDecisionParams(FNodeRef Node, int32 LocalizationIdx) const
 {
+	const FLocalizationRef LocRef(Database, LocalizationIdx);
+	return NativeListener
+		? NativeListener->OnDecisionParams(LocRef, Node)
+		: IGameScriptListener::Execute_OnDecisionParams(Listener.GetObject(), LocRef, Node);
+}
+
+int32 FRunnerContext::GenerateContextID()
+{
+	bAwaitingListener = true;
 	return ++CurrentEventID;
 }
 
-void URunnerContext::CheckActionAndSpeechComplete()
+UGSCompletionHandle* FRunnerContext::AcquirePendingHandle(int32 ContextID)
+{
+	PendingHandle = Runner->AcquireHandle();
+	PendingHandle->Initialize(MakeToken(ContextID));
+	return PendingHandle;
+}
+
+FGSCompletionToken FRunnerContext::MakeToken(int32 ContextID) const
+{
+	return FGSCompletionToken(Runner, Handle, ContextID);
+}
+
+void FRunnerContext::FireSpeech()
+{
+	int32 ContextID = GenerateContextID();
+	if (NativeListener)
+	{
+		NativeListener->OnSpeech(CurrentNode, CachedVoiceText, MakeToken(ContextID));
+	}
+	else
+	{
+		IGameScriptListener::Execute_OnSpeech(Listener.GetObject(), CurrentNode, CachedVoiceText, AcquirePendingHandle(ContextID));
+	}
+}
+
+void FRunnerContext::CheckActionAndSpeechComplete()
 {
 	// Only transition when BOTH action and speech have completed
 	// This matches Unity's WhenAllAwaiter pattern for concurrent execution
@@ -1,11 +1,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "UObject/Object.h"
+#include "UObject/ObjectPtr.h"
+#include "UObject/WeakObjectPtrTemplates.h"
 #include "IDialogueContext.h"
+#include "ActiveConversation.h"
 #include "IGameScriptListener.h"
+#include "ConversationSave.h"
+#include "TextPrefetch.h"
+#include "Containers/ChunkedArray.h"
 #include <atomic>
-#include "RunnerContext.generated.h"
 
 // Forward declarations
 class UGameScriptRunner;
@@ -13,11 +17,18 @@ class UGameScriptDatabase;
 class UGameplayTask;
 class UGSCompletionHandle;
 class UGameplayTasksComponent;
+class IGameScriptNativeListener;
+struct FGSCompletionToken;
+struct FGSReplayScript;
 
 /**
  * State machine for individual conversation execution.
  * Pooled and reused by GameScriptRunner.
  *
+ * A plain C++ class, not a UObject: contexts live in the runner's chunked pool (stable addresses)
+ * and add nothing to the GC graph. The runner reports the few object references they hold
+ * (active task, pending completion handle) from UGameScriptRunner::AddReferencedObjects.
+ *
  * State Flow:
  * ConversationEnter → NodeEnter → ActionAndSpeech → EvaluateEdges →
  * (Decision/AutoDecision) → NodeExit → (loop or ConversationExit) → Cleanup → Idle
@@ -27,30 +38,46 @@ class UGameplayTasksComponent;
  * - Atomic cancellation flag for cooperative task cancellation
  * - Implements IDialogueContext for action/condition access to node data
  */
-UCLASS()
-class URunnerContext : public UObject, public IDialogueContext
+class FRunnerContext : public IDialogueContext
 {
-	GENERATED_BODY()
-
 public:
-	URunnerContext();
+	FRunnerContext();
 
 	/**
 	 * Initialize context for a new conversation.
 	 */
 	void Initialize(
 		UGameScriptRunner* InRunner,
+		FActiveConversation InHandle,
 		int32 InConversationId,
 		TScriptInterface<IGameScriptListener> InListener,
 		UGameplayTasksComponent* InTaskOwner
 	);
 
+	/**
+	 * Continue at a node (or its decision) after ConversationEnter instead of the root.
+	 * Call between Initialize() and Start().
+	 */
+	void SetResumePoint(FNodeRef Node, bool bAtDecision, int32 ExpectedFingerprint);
+
+	/**
+	 * Replay mode: take condition results from a recording and skip actions.
+	 * Call between Initialize() and Start(); null for normal execution.
+	 */
+	void SetReplay(TSharedPtr<FGSReplayScript> InReplay) { Replay = MoveTemp(InReplay); }
+
 	/**
 	 * Start executing the conversation.
 	 * Begins state machine at ConversationEnter.
 	 */
 	void Start();
 
+	/**
+	 * Record where this conversation can be resumed.
+	 * @return False if the conversation is ending (nothing left to resume)
+	 */
+	bool Save(FGSConversationSave& OutSave) const;
+
 	/**
 	 * Cancel the conversation (triggers cleanup and idle).
 	 */
@@ -67,9 +94,32 @@ public:
 	int32 GetContextId() const { return ContextId; }
 
 	/**
-	 * Get the sequence number (for handle validation after reuse).
+	 * Get the runner's handle for the current conversation (slot + generation).
+	 */
+	FActiveConversation GetHandle() const { return Handle; }
+
+	/**
+	 * Record the IDs of every node this context refers to (before a runtime hot reload).
+	 */
+	void CaptureNodeIds();
+
+	/**
+	 * Re-resolve the IDs recorded by CaptureNodeIds() against the reloaded snapshot.
+	 * Cached texts keep their old values until the next node is entered.
+	 * @return False if the conversation or a node it is waiting on no longer exists
+	 */
+	bool RemapNodeIds();
+
+	/** Block until look-ahead text tasks stop reading snapshot memory. */
+	void WaitForTextPrefetch() { TextPrefetch.Wait(); }
+
+	/** Drop look-ahead text (locale changed or snapshot reloaded). */
+	void ResetTextPrefetch() { TextPrefetch.Reset(); }
+
+	/**
+	 * Check if a listener event is still waiting for its completion.
 	 */
-	int32 GetSequence() const { return Sequence; }
+	bool IsAwaitingListener(int32 EventID) const { return bAwaitingListener && EventID == CurrentEventID; }
 
 	/**
 	 * Called by completion handle when listener calls NotifyReady().
@@ -98,10 +148,14 @@ public:
 	virtual int32 GetUIResponseTextLocalizationIdx() const override;
 	virtual int32 GetPropertyCount() const override;
 	virtual FNodePropertyRef GetProperty(int32 Index) const override;
+	virtual FNodePropertyRef FindProperty(FName Name) const override;
 	virtual UGameplayTasksComponent* GetTaskOwner() const override;
 
 private:
-	// State machine states
+	// Worker-thread condition views read the context's cached data
+	friend class FGSConditionContext;
+
+	// State machine states (recorded by ordinal in FGSConversationRecorder - append new states at the end)
 	enum class EState
 	{
 		Idle,
@@ -118,30 +172,30 @@ private:
 
 	EState CurrentState = EState::Idle;
 
-	// Context data (UPROPERTY for GC safety)
-	UPROPERTY()
-	TObjectPtr<UGameScriptRunner> Runner = nullptr;
-
-	UPROPERTY()
-	TObjectPtr<UGameScriptDatabase> Database = nullptr;
+	// Owning runner and its database (the runner outlives its contexts and references the database)
+	UGameScriptRunner* Runner = nullptr;
+	UGameScriptDatabase* Database = nullptr;
 
 	int32 ConversationId = -1;
 	TScriptInterface<IGameScriptListener> Listener;
 
+	// Listener's native interface, resolved once in Initialize (null = Blueprint events + handles)
+	IGameScriptNativeListener* NativeListener = nullptr;
+
 	// Task owner for latent actions
-	UPROPERTY()
 	TWeakObjectPtr<UGameplayTasksComponent> TaskOwner;
 
 	// Current node
 	FNodeRef CurrentNode;
 
-	// Active task (for latent actions - UPROPERTY for GC safety)
-	UPROPERTY()
+	// Runner reports ActiveTask and PendingHandle to GC
+	friend class UGameScriptRunner;
+
+	// Active task (for latent actions)
 	TObjectPtr<UGameplayTask> ActiveTask = nullptr;
 
 	// Pending completion handle (acquired from Runner pool, released after use)
-	UPROPERTY()
-	UGSCompletionHandle* PendingHandle = nullptr;
+	TObjectPtr<UGSCompletionHandle> PendingHandle = nullptr;
 
 	// Cancellation - simple atomic bool, no pool needed since each context needs exactly one
 	std::atomic<bool> bIsCancelled{false};
@@ -150,11 +204,14 @@ private:
 	// Context-ID validation (prevents stale completions)
 	int32 CurrentEventID = 0;
 
+	// Set when an event is fired, cleared by its first accepted completion (tokens can be copied)
+	bool bAwaitingListener = false;
+
 	// Unique context identifier (stable across pool operations, matches Unity pattern)
 	int32 ContextId = -1;
 
-	// Handle validation (incremented on each reuse)
-	int32 Sequence = 0;
+	// Slot map handle for the current conversation (assigned by the runner on acquire)
+	FActiveConversation Handle;
 
 	// Static counter for unique context IDs
 	static int32 NextContextId;
@@ -181,6 +238,45 @@ private:
 	// Pending error message (for ErrorCleanup state)
 	FString PendingErrorMessage;
 
+	// Resume point (StartConversationAtNode / RestoreConversation), consumed after ConversationEnter
+	FNodeRef ResumeNode;
+	bool bResumeAtDecision = false;
+	int32 ResumeFingerprint = 0;
+
+	// Recorded conditions when replaying (null otherwise)
+	TSharedPtr<FGSReplayScript> Replay;
+
+	// Node IDs captured across a runtime hot reload (-1 = no node)
+	int32 CapturedNodeId = -1;
+	int32 CapturedNodeToExitId = -1;
+	TArray<int32> CapturedChoiceIds;
+	TArray<int32> CapturedHighestPriorityIds;
+
+	// Speculative choices (UGameScriptSettings::bSpeculativeChoices): ValidChoices built while
+	// the action/speech plays, with the condition results they depend on (recorded on reuse)
+	struct FSpeculativeCondition
+	{
+		FNodeRef Target;
+		bool bPassed;
+		bool bVolatile;
+	};
+	bool bChoicesSpeculated = false;
+	TArray<FSpeculativeCondition> SpeculativeConditions;
+	int32 ActionAndSpeechSerial = 0;
+
+	// Look-ahead voice/UI text for upcoming nodes (UGameScriptSettings::LookAheadDepth)
+	FGSTextPrefetch TextPrefetch;
+
+	// Parallel conditions (UGameScriptSettings::bParallelConditions): per outgoing edge of the
+	// current node, 1/0 for a result evaluated on a worker, -1 for conditions evaluated serially
+	struct FParallelCondition
+	{
+		int32 EdgeIndex;
+		FNodeRef Target;
+	};
+	TArray<FParallelCondition> ParallelConditions;
+	TArray<int8> ParallelConditionResults;
+
 	// --- State Machine Methods ---
 
 	void EnterConversationEnter();
@@ -200,23 +296,93 @@ private:
 
 	// --- Callbacks ---
 
-	UFUNCTION()
 	void OnActionCompleted();
-
-	UFUNCTION()
 	void OnActionCancelled();
 
+	/**
+	 * Run Callback on the game thread if this conversation is still the slot's current one
+	 * (completions and cancellation arriving from other threads).
+	 */
+	void QueueOnGameThread(TFunction<void(FRunnerContext&)> Callback) const;
+
 	// --- Helpers ---
 
 	void ExecuteAction(FNodeRef Node);
 	bool EvaluateCondition(FNodeRef Node);
-	void FindValidChoices();
+	void EvaluateConditionsInParallel(int32 EdgeCount);
+	void FindValidChoices(bool bSpeculative = false);
+	bool ReuseSpeculativeChoices();
+	int32 GetChoiceFingerprint() const;
 	void CacheNodeTexts();
 	int32 GenerateContextID();
 
+	// Completion for a listener event: a pooled handle (Blueprint path) or a token (native path)
+	UGSCompletionHandle* AcquirePendingHandle(int32 ContextID);
+	FGSCompletionToken MakeToken(int32 ContextID) const;
+	void FireSpeech();
+
+	// Synchronous listener queries (native listener directly, Blueprint listener via Execute_)
+	FTextResolutionParams GetSpeechParams(FNodeRef Node, int32 LocalizationIdx) const;
+	FTextResolutionParams GetDecisionParams(FNodeRef Node, int32 LocalizationIdx) const;
+
 	/**
 	 * Check if both action and speech have completed.
 	 * Called after either completes to transition to EvaluateEdges when both done.
 	 */
 	void CheckActionAndSpeechComplete();
 };
+
+/**
+ * A runner's contexts, indexed by slot. Chunked: addresses stay stable as the pool grows
+ * (contexts stay referenced across listener callbacks) and contexts are contiguous within a chunk.
+ */
+class FRunnerContextPool
+{
+public:
+	/** Add a default-constructed context. @return Its slot */
+	int32 Add() { return Contexts.Add(); }
+
+	int32 Num() const { return Contexts.Num(); }
+
+	FRunnerContext& operator[](int32 Slot) { return Contexts[Slot]; }
+
+private:
+	// Sized in contexts rather than bytes: a context must never outgrow its chunk
+	static constexpr uint32 ContextsPerChunk = 8;
+
+	TChunkedArray<FRunnerContext, sizeof(FRunnerContext) * ContextsPerChunk> Contexts;
+};
+
+/**
+ * Per-task IDialogueContext for a condition evaluated on a worker thread.
+ * Presents the target node the way FRunnerContext::EvaluateCondition() does, without
+ * swapping the context's current node, so any number of views can be read concurrently.
+ */
+class FGSConditionContext final : public IDialogueContext
+{
+public:
+	FGSConditionContext(const FRunnerContext* InOwner, FNodeRef InNode, UGameplayTasksComponent* InTaskOwner)
+		: Owner(InOwner)
+		, Node(InNode)
+		, TaskOwner(InTaskOwner)
+	{
+	}
+
+	virtual bool IsCancelled() const override { return Owner->IsCancelled(); }
+	virtual int32 GetNodeId() const override { return Node.GetId(); }
+	virtual int32 GetConversationId() const override { return Owner->ConversationId; }
+	virtual FActorRef GetActor() const override { return Node.GetActor(); }
+	virtual FString GetVoiceText() const override { return Owner->CachedVoiceText; }
+	virtual FString GetUIResponseText() const override { return Owner->CachedUIResponseText; }
+	virtual int32 GetVoiceTextLocalizationIdx() const override { return Node.GetVoiceTextLocalizationIdx(); }
+	virtual int32 GetUIResponseTextLocalizationIdx() const override { return Node.GetUIResponseTextLocalizationIdx(); }
+	virtual int32 GetPropertyCount() const override { return Node.GetPropertyCount(); }
+	virtual FNodePropertyRef GetProperty(int32 Index) const override;
+	virtual FNodePropertyRef FindProperty(FName Name) const override { return Node.FindProperty(Name); }
+	virtual UGameplayTasksComponent* GetTaskOwner() const override { return TaskOwner; }
+
+private:
+	const FRunnerContext* Owner;
+	FNodeRef Node;
+	UGameplayTasksComponent* TaskOwner;   // Resolved on the game thread
+};
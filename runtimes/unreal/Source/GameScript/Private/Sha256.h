@@ -0,0 +1,37 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Incremental SHA-256 (FIPS 180-4).
+ * Matches the exporter's manifest `hash` (lowercase hex SHA-256 of the .gsb), so snapshots
+ * and patch results can be verified while streaming without holding the whole file.
+ */
+class FGSSha256
+{
+public:
+	static constexpr int32 DigestSize = 32;
+
+	FGSSha256() { Reset(); }
+
+	void Reset();
+	void Update(const uint8* Data, int64 Size);
+	void Final(uint8 OutDigest[DigestSize]);
+
+	/** Finalize and return the digest as lowercase hex (manifest format). */
+	FString FinalHex();
+
+	/** Hash a whole buffer and return lowercase hex. */
+	static FString HashHex(TConstArrayView<uint8> Data);
+
+	/** Lowercase hex encoding of a digest. */
+	static FString ToHex(const uint8 Digest[DigestSize]);
+
+private:
+	void Transform(const uint8* Block);
+
+	uint32 State[8];
+	uint8 Buffer[64];
+	uint64 TotalBytes = 0;
+	int32 BufferedBytes = 0;
+};
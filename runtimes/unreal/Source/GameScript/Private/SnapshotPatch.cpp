@@ -0,0 +1,432 @@
+#include "SnapshotPatch.h"
+#include "GameScript.h"
+#include "Sha256.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryWriter.h"
+#include "Hash/CityHash.h"
+#include "Generated/snapshot_generated.h"
+
+namespace GameScriptPatch
+{
+	// Fixed streaming chunk - the only buffer Apply() allocates
+	static constexpr int32 ChunkSize = 64 * 1024;
+
+	// Copy a range from one archive to another through the chunk buffer, hashing as we go
+	static bool StreamRange(FArchive& Source, FArchive& Dest, uint32 Length, TArray<uint8>& Chunk, FGSSha256& Hasher)
+	{
+		while (Length > 0)
+		{
+			const int32 Count = FMath::Min<uint32>(Length, ChunkSize);
+			Source.Serialize(Chunk.GetData(), Count);
+			if (Source.IsError())
+			{
+				return false;
+			}
+			Dest.Serialize(Chunk.GetData(), Count);
+			Hasher.Update(Chunk.GetData(), Count);
+			Length -= Count;
+		}
+		return !Dest.IsError();
+	}
+
+	static bool ApplyOps(FArchive& Base, FArchive& Patch, FArchive& Out, const FGSPatchHeader& Header, FString& OutTargetHash)
+	{
+		TArray<uint8> Chunk;
+		Chunk.SetNumUninitialized(ChunkSize);
+
+		FGSSha256 Hasher;
+		int64 Written = 0;
+		const int64 BaseSize = Base.TotalSize();
+
+		for (;;)
+		{
+			uint8 Op = 0;
+			Patch << Op;
+			if (Patch.IsError())
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Snapshot patch is truncated"));
+				return false;
+			}
+
+			if (Op == static_cast<uint8>(EOp::End))
+			{
+				break;
+			}
+
+			uint32 Length = 0;
+			if (Op == static_cast<uint8>(EOp::Copy))
+			{
+				uint32 Offset = 0;
+				Patch << Offset << Length;
+				if (static_cast<int64>(Offset) + Length > BaseSize)
+				{
+					UE_LOG(LogGameScript, Error, TEXT("Snapshot patch copies past the end of the base snapshot"));
+					return false;
+				}
+				Base.Seek(Offset);
+				if (!StreamRange(Base, Out, Length, Chunk, Hasher))
+				{
+					return false;
+				}
+			}
+			else if (Op == static_cast<uint8>(EOp::Insert))
+			{
+				Patch << Length;
+				if (!StreamRange(Patch, Out, Length, Chunk, Hasher))
+				{
+					return false;
+				}
+			}
+			else
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Snapshot patch contains unknown op %u"), Op);
+				return false;
+			}
+
+			Written += Length;
+			if (Written > Header.TargetSize)
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Snapshot patch output exceeds declared size %u"), Header.TargetSize);
+				return false;
+			}
+		}
+
+		if (Written != Header.TargetSize)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Snapshot patch produced %lld bytes, expected %u"), Written, Header.TargetSize);
+			return false;
+		}
+
+		OutTargetHash = Hasher.FinalHex();
+		if (OutTargetHash != FGSSha256::ToHex(Header.TargetHash))
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Patched snapshot hash mismatch (got %s)"), *OutTargetHash);
+			return false;
+		}
+
+		return true;
+	}
+
+	bool Apply(const FString& BasePath, const FString& PatchPath, const FString& OutPath, FString& OutTargetHash)
+	{
+		TUniquePtr<FArchive> Patch(IFileManager::Get().CreateFileReader(*PatchPath));
+		TUniquePtr<FArchive> Base(IFileManager::Get().CreateFileReader(*BasePath));
+		if (!Patch || !Base)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Failed to open snapshot patch %s or base %s"), *PatchPath, *BasePath);
+			return false;
+		}
+
+		FGSPatchHeader Header;
+		*Patch << Header;
+		if (Patch->IsError() || Header.Magic != Magic || Header.Version != Version)
+		{
+			UE_LOG(LogGameScript, Error, TEXT("Invalid snapshot patch header: %s"), *PatchPath);
+			return false;
+		}
+
+		// Verify the base before producing anything (streamed in chunks, like the ops)
+		{
+			TArray<uint8> Chunk;
+			Chunk.SetNumUninitialized(ChunkSize);
+			FGSSha256 BaseHasher;
+			for (int64 Remaining = Base->TotalSize(); Remaining > 0;)
+			{
+				const int32 Count = static_cast<int32>(FMath::Min<int64>(Remaining, ChunkSize));
+				Base->Serialize(Chunk.GetData(), Count);
+				BaseHasher.Update(Chunk.GetData(), Count);
+				Remaining -= Count;
+			}
+
+			const FString BaseHash = BaseHasher.FinalHex();
+			if (Base->IsError() || BaseHash != FGSSha256::ToHex(Header.BaseHash))
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Snapshot patch %s does not apply to %s (base hash %s)"), *PatchPath, *BasePath, *BaseHash);
+				return false;
+			}
+		}
+
+		bool bApplied = false;
+		{
+			TUniquePtr<FArchive> Out(IFileManager::Get().CreateFileWriter(*OutPath));
+			if (!Out)
+			{
+				UE_LOG(LogGameScript, Error, TEXT("Failed to create patched snapshot: %s"), *OutPath);
+				return false;
+			}
+			bApplied = ApplyOps(*Base, *Patch, *Out, Header, OutTargetHash);
+			bApplied &= Out->Close();
+		}
+
+		if (!bApplied)
+		{
+			IFileManager::Get().Delete(*OutPath);
+		}
+		return bApplied;
+	}
+
+	/**
+	 * Feeds snapshot fields into a SHA-256 in a fixed order. A missing vector or string hashes like
+	 * an empty one: the split and chunked writers may store either.
+	 */
+	struct FStructureHasher
+	{
+		FGSSha256 Hasher;
+
+		void Int(int32 Value)
+		{
+			Hasher.Update(reinterpret_cast<const uint8*>(&Value), sizeof(Value));
+		}
+
+		void Float(float Value)
+		{
+			uint32 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+			Hasher.Update(reinterpret_cast<const uint8*>(&Bits), sizeof(Bits));
+		}
+
+		void String(const flatbuffers::String* Value)
+		{
+			Int(Value ? static_cast<int32>(Value->size()) : 0);
+			if (Value)
+			{
+				Hasher.Update(reinterpret_cast<const uint8*>(Value->data()), Value->size());
+			}
+		}
+
+		void Ints(const flatbuffers::Vector<int32_t>* Values)
+		{
+			Int(Values ? static_cast<int32>(Values->size()) : 0);
+			if (Values)
+			{
+				Hasher.Update(reinterpret_cast<const uint8*>(Values->data()), Values->size() * sizeof(int32_t));
+			}
+		}
+
+		void Strings(const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* Values)
+		{
+			Int(Values ? static_cast<int32>(Values->size()) : 0);
+			if (Values)
+			{
+				for (const flatbuffers::String* Value : *Values)
+				{
+					String(Value);
+				}
+			}
+		}
+
+		template<typename TTable, typename TFieldsFunc>
+		void Tables(const flatbuffers::Vector<flatbuffers::Offset<TTable>>* Values, TFieldsFunc Fields)
+		{
+			Int(Values ? static_cast<int32>(Values->size()) : 0);
+			if (Values)
+			{
+				for (const TTable* Value : *Values)
+				{
+					Fields(Value);
+				}
+			}
+		}
+
+		/** Node and conversation properties share their layout. */
+		template<typename TProperty>
+		void Properties(const flatbuffers::Vector<flatbuffers::Offset<TProperty>>* Values)
+		{
+			Tables(Values, [this](const TProperty* Property)
+			{
+				Int(Property->template_idx());
+				Int(Property->value_type());
+				switch (Property->value_type())
+				{
+				case GameScript::PropertyValue_string_val:
+					String(Property->value_as_string_val());
+					break;
+				case GameScript::PropertyValue_int_val:
+					Int(Property->value_as_int_val() ? Property->value_as_int_val()->value() : 0);
+					break;
+				case GameScript::PropertyValue_decimal_val:
+					Float(Property->value_as_decimal_val() ? Property->value_as_decimal_val()->value() : 0.0f);
+					break;
+				case GameScript::PropertyValue_bool_val:
+					Int(Property->value_as_bool_val() && Property->value_as_bool_val()->value());
+					break;
+				default:
+					break;
+				}
+			});
+		}
+	};
+
+	void HashStructure(const GameScript::Snapshot* Snapshot, uint8 OutDigest[FGSSha256::DigestSize])
+	{
+		FStructureHasher H;
+
+		auto TagValues = [&H](const GameScript::StringArray* Values) { H.Strings(Values->values()); };
+		H.Strings(Snapshot->conversation_tag_names());
+		H.Tables(Snapshot->conversation_tag_values(), TagValues);
+		H.Strings(Snapshot->localization_tag_names());
+		H.Tables(Snapshot->localization_tag_values(), TagValues);
+
+		H.Tables(Snapshot->conversations(), [&H](const GameScript::Conversation* Conv)
+		{
+			H.Int(Conv->id());
+			H.String(Conv->name());
+			H.String(Conv->notes());
+			H.Int(Conv->is_layout_auto());
+			H.Int(Conv->is_layout_vertical());
+			H.Ints(Conv->tag_indices());
+			H.Properties(Conv->properties());
+			H.Ints(Conv->node_indices());
+			H.Ints(Conv->edge_indices());
+			H.Int(Conv->root_node_idx());
+		});
+
+		H.Tables(Snapshot->nodes(), [&H](const GameScript::Node* Node)
+		{
+			H.Int(Node->id());
+			H.Int(Node->conversation_idx());
+			H.Int(Node->type());
+			H.Int(Node->actor_idx());
+			H.Int(Node->voice_text_idx());
+			H.Int(Node->ui_response_text_idx());
+			H.Int(Node->has_condition());
+			H.Int(Node->has_action());
+			H.Int(Node->is_prevent_response());
+			H.Float(Node->position_x());
+			H.Float(Node->position_y());
+			H.String(Node->notes());
+			H.Properties(Node->properties());
+			H.Ints(Node->outgoing_edge_indices());
+			H.Ints(Node->incoming_edge_indices());
+		});
+
+		H.Tables(Snapshot->edges(), [&H](const GameScript::Edge* Edge)
+		{
+			H.Int(Edge->id());
+			H.Int(Edge->conversation_idx());
+			H.Int(Edge->source_idx());
+			H.Int(Edge->target_idx());
+			H.Int(Edge->priority());
+			H.Int(Edge->type());
+		});
+
+		H.Tables(Snapshot->actors(), [&H](const GameScript::Actor* Actor)
+		{
+			H.Int(Actor->id());
+			H.String(Actor->name());
+			H.String(Actor->color());
+			H.Int(Actor->grammatical_gender());
+			H.Int(Actor->localized_name_idx());
+		});
+
+		// Everything but the variants (the text itself)
+		H.Tables(Snapshot->localizations(), [&H](const GameScript::Localization* Loc)
+		{
+			H.Int(Loc->id());
+			H.String(Loc->name());
+			H.Int(Loc->subject_actor_idx());
+			H.Int(Loc->subject_gender());
+			H.Int(Loc->is_templated());
+			H.Ints(Loc->tag_indices());
+		});
+
+		H.Tables(Snapshot->property_templates(), [&H](const GameScript::PropertyTemplate* Template)
+		{
+			H.Int(Template->id());
+			H.String(Template->name());
+			H.Int(Template->type());
+		});
+
+		H.Hasher.Final(OutDigest);
+	}
+
+#if WITH_EDITOR
+	// Base is indexed at window-aligned offsets; every target offset is probed,
+	// so shifted content still matches after at most one window of literal bytes
+	static constexpr int32 MatchWindow = 32;
+
+	static void WriteInsert(FArchive& Ar, const uint8* Data, int64 Length)
+	{
+		if (Length <= 0)
+		{
+			return;
+		}
+		uint8 Op = static_cast<uint8>(EOp::Insert);
+		uint32 Length32 = static_cast<uint32>(Length);
+		Ar << Op << Length32;
+		Ar.Serialize(const_cast<uint8*>(Data), Length);
+	}
+
+	void Create(TConstArrayView<uint8> Base, TConstArrayView<uint8> Target, TArray<uint8>& OutPatch)
+	{
+		const uint8* BaseData = Base.GetData();
+		const uint8* TargetData = Target.GetData();
+		const int64 BaseSize = Base.Num();
+		const int64 TargetSize = Target.Num();
+
+		FGSPatchHeader Header;
+		Header.Magic = Magic;
+		Header.Version = Version;
+		Header.TargetSize = static_cast<uint32>(TargetSize);
+		{
+			FGSSha256 Hasher;
+			Hasher.Update(BaseData, BaseSize);
+			Hasher.Final(Header.BaseHash);
+			Hasher.Update(TargetData, TargetSize);
+			Hasher.Final(Header.TargetHash);
+		}
+
+		TMap<uint64, uint32> WindowOffsets;
+		WindowOffsets.Reserve(BaseSize / MatchWindow);
+		for (int64 Offset = 0; Offset + MatchWindow <= BaseSize; Offset += MatchWindow)
+		{
+			WindowOffsets.FindOrAdd(CityHash64(reinterpret_cast<const char*>(BaseData + Offset), MatchWindow), static_cast<uint32>(Offset));
+		}
+
+		OutPatch.Reset();
+		FMemoryWriter Writer(OutPatch);
+		Writer << Header;
+
+		int64 LiteralStart = 0;
+		int64 Pos = 0;
+		while (Pos + MatchWindow <= TargetSize)
+		{
+			const uint32* Match = WindowOffsets.Find(CityHash64(reinterpret_cast<const char*>(TargetData + Pos), MatchWindow));
+			if (!Match || FMemory::Memcmp(BaseData + *Match, TargetData + Pos, MatchWindow) != 0)
+			{
+				++Pos;
+				continue;
+			}
+
+			// Extend the match forward, then backward over pending literal bytes
+			int64 BaseStart = *Match;
+			int64 Length = MatchWindow;
+			while (Pos + Length < TargetSize && BaseStart + Length < BaseSize && TargetData[Pos + Length] == BaseData[BaseStart + Length])
+			{
+				++Length;
+			}
+			while (Pos > LiteralStart && BaseStart > 0 && TargetData[Pos - 1] == BaseData[BaseStart - 1])
+			{
+				--Pos;
+				--BaseStart;
+				++Length;
+			}
+
+			WriteInsert(Writer, TargetData + LiteralStart, Pos - LiteralStart);
+
+			uint8 Op = static_cast<uint8>(EOp::Copy);
+			uint32 Offset32 = static_cast<uint32>(BaseStart);
+			uint32 Length32 = static_cast<uint32>(Length);
+			Writer << Op << Offset32 << Length32;
+
+			Pos += Length;
+			LiteralStart = Pos;
+		}
+
+		WriteInsert(Writer, TargetData + LiteralStart, TargetSize - LiteralStart);
+
+		uint8 End = static_cast<uint8>(EOp::End);
+		Writer << End;
+	}
+#endif
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Sha256.h"
+
+namespace GameScript { struct Snapshot; }
+
+/**
+ * Binary delta patch (.gsd) that rebuilds one snapshot from another.
+ *
+ *   FGSPatchHeader
+ *   Ops until End:
+ *     Copy   (uint8 1, uint32 BaseOffset, uint32 Length) - bytes from the base snapshot
+ *     Insert (uint8 2, uint32 Length, bytes)             - literal bytes from the patch
+ *     End    (uint8 0)
+ *
+ * Patches are applied by streaming through fixed-size chunks: memory use does not depend on
+ * snapshot or patch size. Both sides are identified by SHA-256 of the raw .gsb, the same hash
+ * the exporter writes to manifest.json.
+ *
+ * Patches are localization hotfixes: a patch that changes anything but text is rejected at
+ * install (see HashStructure), so a loaded structure, its ID maps and running conversations stay valid.
+ */
+namespace GameScriptPatch
+{
+	/** 'GSD1' */
+	constexpr uint32 Magic = 0x31445347;
+	constexpr uint32 Version = 1;
+
+	/** File extension for snapshot patches. */
+	inline const TCHAR* Extension() { return TEXT(".gsd"); }
+
+	enum class EOp : uint8
+	{
+		End = 0,
+		Copy = 1,
+		Insert = 2
+	};
+
+	/**
+	 * Apply a patch to a base snapshot on disk, writing the result to OutPath.
+	 * Verifies the base against the patch's base hash before writing, and the result
+	 * against the patch's target hash after. OutPath is left behind only on success.
+	 * @param OutTargetHash - Lowercase hex SHA-256 of the written result
+	 */
+	bool Apply(const FString& BasePath, const FString& PatchPath, const FString& OutPath, FString& OutTargetHash);
+
+	/**
+	 * SHA-256 of everything in a snapshot except text: every table but the locale metadata and the
+	 * localizations' variants. Snapshots with equal digests differ only in text, and a split
+	 * structure or chunked index digests like the .gsb it came from. The snapshot must be verified.
+	 */
+	void HashStructure(const GameScript::Snapshot* Snapshot, uint8 OutDigest[FGSSha256::DigestSize]);
+
+#if WITH_EDITOR
+	/**
+	 * Create a patch that turns Base into Target (greedy block matching).
+	 */
+	void Create(TConstArrayView<uint8> Base, TConstArrayView<uint8> Target, TArray<uint8>& OutPatch);
+#endif
+}
+
+struct FGSPatchHeader
+{
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint32 TargetSize = 0;
+	uint8 BaseHash[32] = {};
+	uint8 TargetHash[32] = {};
+
+	friend FArchive& operator<<(FArchive& Ar, FGSPatchHeader& Header)
+	{
+		Ar << Header.Magic << Header.Version << Header.TargetSize;
+		Ar.Serialize(Header.BaseHash, sizeof(Header.BaseHash));
+		Ar.Serialize(Header.TargetHash, sizeof(Header.TargetHash));
+		return Ar;
+	}
+};
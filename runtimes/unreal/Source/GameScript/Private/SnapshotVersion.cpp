@@ -0,0 +1,258 @@
+#include "SnapshotVersion.h"
+#include "Generated/snapshot_generated.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
+
+static std::atomic<uint32> GNextSnapshotVersion{0};
+
+namespace
+{
+	using FTable = flatbuffers::Table;
+	using FTableVector = flatbuffers::Vector<flatbuffers::Offset<FTable>>;
+	using FStringVector = flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>;
+
+	/** Verify a vector of tables field, then each table with PerTable (which must end the table). */
+	template <typename FPerTable>
+	bool VerifyTables(flatbuffers::Verifier& Verifier, const FTable* Owner, flatbuffers::voffset_t Field, FPerTable PerTable)
+	{
+		if (!Owner->VerifyOffset(Verifier, Field))
+		{
+			return false;
+		}
+		const FTableVector* Tables = Owner->GetPointer<const FTableVector*>(Field);
+		if (!Verifier.VerifyVector(Tables))
+		{
+			return false;
+		}
+		for (flatbuffers::uoffset_t i = 0; Tables && i < Tables->size(); ++i)
+		{
+			const FTable* Table = Tables->Get(i);
+			if (!Table->VerifyTableStart(Verifier) || !PerTable(Table) || !Verifier.EndTable())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool VerifyStrings(flatbuffers::Verifier& Verifier, const FTable* Owner, flatbuffers::voffset_t Field)
+	{
+		const FStringVector* Strings = Owner->GetPointer<const FStringVector*>(Field);
+		return Owner->VerifyOffset(Verifier, Field) && Verifier.VerifyVector(Strings) && Verifier.VerifyVectorOfStrings(Strings);
+	}
+}
+
+bool FGSSnapshotStructure::VerifyIndexedFields(TConstArrayView<uint8> InBuffer)
+{
+	using namespace GameScript;
+
+	if (InBuffer.Num() <= 8 || !SnapshotBufferHasIdentifier(InBuffer.GetData()))
+	{
+		return false;
+	}
+
+	flatbuffers::Verifier Verifier(InBuffer.GetData(), InBuffer.Num());
+	const size_t RootOffset = Verifier.VerifyOffset(0);
+	if (!RootOffset)
+	{
+		return false;
+	}
+	const FTable* Root = reinterpret_cast<const FTable*>(InBuffer.GetData() + RootOffset);
+
+	// Every entity's id and every property's template_idx is its table's first field
+	static_assert(Node::VT_ID == Conversation::VT_ID && Node::VT_ID == Localization::VT_ID && Node::VT_ID == Actor::VT_ID
+		&& Node::VT_ID == Edge::VT_ID && Node::VT_ID == PropertyTemplate::VT_ID, "Entity IDs share a vtable slot");
+	static_assert(NodeProperty::VT_TEMPLATE_IDX == ConversationProperty::VT_TEMPLATE_IDX, "Template indices share a vtable slot");
+	auto Id = [&Verifier](const FTable* Table)
+	{
+		return Table->VerifyField<int32_t>(Verifier, Node::VT_ID, 4);
+	};
+	auto TemplateIndices = [&Verifier](const FTable* Table)
+	{
+		return Table->VerifyField<int32_t>(Verifier, NodeProperty::VT_TEMPLATE_IDX, 4);
+	};
+	auto TagValues = [&Verifier](const FTable* Table)
+	{
+		return VerifyStrings(Verifier, Table, StringArray::VT_VALUES);
+	};
+	auto TagIndices = [&Verifier](const FTable* Table, flatbuffers::voffset_t Field)
+	{
+		return Table->VerifyOffset(Verifier, Field) && Verifier.VerifyVector(Table->GetPointer<const flatbuffers::Vector<int32_t>*>(Field));
+	};
+
+	return Root->VerifyTableStart(Verifier)
+		&& VerifyTables(Verifier, Root, Snapshot::VT_NODES, [&](const FTable* Table)
+			{
+				return Id(Table) && VerifyTables(Verifier, Table, Node::VT_PROPERTIES, TemplateIndices);
+			})
+		&& VerifyTables(Verifier, Root, Snapshot::VT_CONVERSATIONS, [&](const FTable* Table)
+			{
+				return Id(Table) && TagIndices(Table, Conversation::VT_TAG_INDICES)
+					&& VerifyTables(Verifier, Table, Conversation::VT_PROPERTIES, TemplateIndices);
+			})
+		&& VerifyTables(Verifier, Root, Snapshot::VT_LOCALIZATIONS, [&](const FTable* Table)
+			{
+				return Id(Table) && TagIndices(Table, Localization::VT_TAG_INDICES);
+			})
+		&& VerifyTables(Verifier, Root, Snapshot::VT_ACTORS, Id)
+		&& VerifyTables(Verifier, Root, Snapshot::VT_EDGES, Id)
+		&& VerifyTables(Verifier, Root, Snapshot::VT_PROPERTY_TEMPLATES, [&](const FTable* Table)
+			{
+				return Id(Table) && Table->VerifyOffset(Verifier, PropertyTemplate::VT_NAME)
+					&& Verifier.VerifyString(Table->GetPointer<const flatbuffers::String*>(PropertyTemplate::VT_NAME));
+			})
+		&& VerifyStrings(Verifier, Root, Snapshot::VT_CONVERSATION_TAG_NAMES)
+		&& VerifyTables(Verifier, Root, Snapshot::VT_CONVERSATION_TAG_VALUES, TagValues)
+		&& VerifyStrings(Verifier, Root, Snapshot::VT_LOCALIZATION_TAG_NAMES)
+		&& VerifyTables(Verifier, Root, Snapshot::VT_LOCALIZATION_TAG_VALUES, TagValues)
+		&& Verifier.EndTable();
+}
+
+FGSSnapshotStructure::FGSSnapshotStructure(TArray<uint8>&& InBuffer)
+	: Buffer(MoveTemp(InBuffer))
+{
+	Snapshot = GameScript::GetSnapshot(Buffer.GetData());
+
+	// Helper lambda to build ID maps (eliminates code duplication)
+	auto BuildIdMap = [](const auto* Entities, TMap<int32, int32>& OutMap)
+	{
+		if (!Entities)
+		{
+			return;
+		}
+		OutMap.Reserve(Entities->size());
+		for (int32 i = 0; i < static_cast<int32>(Entities->size()); ++i)
+		{
+			OutMap.Add(Entities->Get(i)->id(), i);
+		}
+	};
+
+	// Build all ID to index maps
+	BuildIdMap(Snapshot->nodes(), NodeIdToIndex);
+	BuildIdMap(Snapshot->conversations(), ConversationIdToIndex);
+	BuildIdMap(Snapshot->actors(), ActorIdToIndex);
+	BuildIdMap(Snapshot->localizations(), LocalizationIdToIndex);
+	BuildIdMap(Snapshot->edges(), EdgeIdToIndex);
+	BuildIdMap(Snapshot->property_templates(), PropertyTemplateIdToIndex);
+
+	// Template names become FNames once here, so lookups never touch UTF-8
+	if (const auto* Templates = Snapshot->property_templates())
+	{
+		PropertyTemplateNameToIndex.Reserve(Templates->size());
+		for (int32 i = 0; i < static_cast<int32>(Templates->size()); ++i)
+		{
+			const GameScript::PropertyTemplate* Template = Templates->Get(i);
+			if (Template->name())
+			{
+				// First template wins if names collide (FName comparison ignores case)
+				const FName Name(UTF8_TO_TCHAR(Template->name()->c_str()));
+				if (!PropertyTemplateNameToIndex.Contains(Name))
+				{
+					PropertyTemplateNameToIndex.Add(Name, i);
+				}
+			}
+		}
+	}
+
+	// Flatten each entity's properties, sorted by template index for binary search
+	auto BuildPropertySlots = [](const auto* Entities, TArray<FPropertySlot>& OutSlots, TArray<int32>& OutOffsets)
+	{
+		const int32 Count = Entities ? static_cast<int32>(Entities->size()) : 0;
+		OutOffsets.SetNumUninitialized(Count + 1);
+		for (int32 i = 0; i < Count; ++i)
+		{
+			OutOffsets[i] = OutSlots.Num();
+			const auto* Properties = Entities->Get(i)->properties();
+			if (!Properties)
+			{
+				continue;
+			}
+			for (int32 p = 0; p < static_cast<int32>(Properties->size()); ++p)
+			{
+				OutSlots.Add({Properties->Get(p)->template_idx(), p});
+			}
+			// Stable: with duplicate templates the first property wins, like a linear scan
+			TArrayView<FPropertySlot> Range(OutSlots.GetData() + OutOffsets[i], OutSlots.Num() - OutOffsets[i]);
+			Algo::StableSortBy(Range, &FPropertySlot::TemplateIndex);
+		}
+		OutOffsets[Count] = OutSlots.Num();
+	};
+
+	BuildPropertySlots(Snapshot->nodes(), NodePropertySlots, NodePropertyOffsets);
+	BuildPropertySlots(Snapshot->conversations(), ConversationPropertySlots, ConversationPropertyOffsets);
+
+	// Tag categories, then each entity's value per category (-1 = untagged)
+	auto BuildTagIndex = [](const auto* Names, const auto* Values, const auto* Entities, FGSTagIndex& OutIndex)
+	{
+		const int32 CategoryCount = Names && Values ? FMath::Min<int32>(Names->size(), Values->size()) : 0;
+		TArray<FString> ValueNames;
+		for (int32 c = 0; c < CategoryCount; ++c)
+		{
+			ValueNames.Reset();
+			if (const auto* CategoryValues = Values->Get(c)->values())
+			{
+				for (const flatbuffers::String* Value : *CategoryValues)
+				{
+					ValueNames.Add(FString(UTF8_TO_TCHAR(Value->c_str())));
+				}
+			}
+			OutIndex.AddCategory(FString(UTF8_TO_TCHAR(Names->Get(c)->c_str())), ValueNames);
+		}
+
+		const int32 EntityCount = Entities ? static_cast<int32>(Entities->size()) : 0;
+		for (int32 i = 0; i < EntityCount && CategoryCount > 0; ++i)
+		{
+			const auto* TagIndices = Entities->Get(i)->tag_indices();
+			const int32 Count = TagIndices ? FMath::Min<int32>(TagIndices->size(), CategoryCount) : 0;
+			for (int32 c = 0; c < Count; ++c)
+			{
+				const int32 Value = TagIndices->Get(c);
+				if (Value >= 0)
+				{
+					OutIndex.Add(c, Value, i);
+				}
+			}
+		}
+		OutIndex.Finalize(EntityCount);
+	};
+
+	BuildTagIndex(Snapshot->conversation_tag_names(), Snapshot->conversation_tag_values(), Snapshot->conversations(), ConversationTags);
+	BuildTagIndex(Snapshot->localization_tag_names(), Snapshot->localization_tag_values(), Snapshot->localizations(), LocalizationTags);
+}
+
+int32 FGSSnapshotStructure::FindProperty(const TArray<FPropertySlot>& Slots, const TArray<int32>& Offsets,
+	int32 EntityIndex, FName Name) const
+{
+	const int32* TemplateIndex = PropertyTemplateNameToIndex.Find(Name);
+	if (!TemplateIndex || EntityIndex < 0 || EntityIndex + 1 >= Offsets.Num())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Begin = Offsets[EntityIndex];
+	TArrayView<const FPropertySlot> Range(Slots.GetData() + Begin, Offsets[EntityIndex + 1] - Begin);
+	const int32 Found = Algo::LowerBoundBy(Range, *TemplateIndex, &FPropertySlot::TemplateIndex);
+	return Found < Range.Num() && Range[Found].TemplateIndex == *TemplateIndex ? Range[Found].PropertyIndex : INDEX_NONE;
+}
+
+FGSSnapshotVersion::FGSSnapshotVersion(TSharedRef<const FGSSnapshotStructure, ESPMode::ThreadSafe> InStructure, TArray<uint8>&& InStringTableBuffer)
+	: Version(++GNextSnapshotVersion)
+	, Structure(MoveTemp(InStructure))
+	, StringTableBuffer(MoveTemp(InStringTableBuffer))
+{
+	if (StringTableBuffer.Num() > 0)
+	{
+		StringTable = GameScript::GetSnapshot(StringTableBuffer.GetData());
+	}
+}
+
+const GameScript::Localization* FGSSnapshotVersion::GetLocalizationText(int32 LocalizationIdx) const
+{
+	const GameScript::Snapshot* Snapshot = GetSnapshot();
+	if (!Snapshot || !Snapshot->localizations()
+		|| LocalizationIdx < 0 || LocalizationIdx >= static_cast<int32>(Snapshot->localizations()->size()))
+	{
+		return nullptr;
+	}
+	return GetLocaleSnapshot()->localizations()->Get(LocalizationIdx);
+}
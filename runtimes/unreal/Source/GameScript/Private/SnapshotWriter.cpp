@@ -0,0 +1,256 @@
+#include "SnapshotWriter.h"
+
+#if WITH_EDITOR
+
+#include "Generated/snapshot_generated.h"
+
+using FFlatBufferBuilder = flatbuffers::FlatBufferBuilder;
+
+// --- Copy Helpers ---
+
+static flatbuffers::Offset<flatbuffers::String> CopyString(FFlatBufferBuilder& Builder, const flatbuffers::String* Source)
+{
+	return Source ? Builder.CreateString(Source->c_str(), Source->size()) : 0;
+}
+
+static flatbuffers::Offset<flatbuffers::Vector<int32_t>> CopyIntVector(FFlatBufferBuilder& Builder, const flatbuffers::Vector<int32_t>* Source)
+{
+	return Source ? Builder.CreateVector(Source->data(), Source->size()) : 0;
+}
+
+/**
+ * Template helper: copy a vector of tables through a per-element copy function.
+ * Eliminates duplication across the entity collections. CopyElement receives (Element, Index).
+ */
+template<typename TOut, typename TIn, typename TCopyFunc>
+static flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<TOut>>> CopyTableVector(
+	FFlatBufferBuilder& Builder,
+	const flatbuffers::Vector<flatbuffers::Offset<TIn>>* Source,
+	TCopyFunc CopyElement)
+{
+	if (!Source)
+	{
+		return 0;
+	}
+
+	TArray<flatbuffers::Offset<TOut>> Offsets;
+	Offsets.Reserve(Source->size());
+	for (int32 i = 0; i < static_cast<int32>(Source->size()); ++i)
+	{
+		Offsets.Add(CopyElement(Source->Get(i), i));
+	}
+	return Builder.CreateVector(Offsets.GetData(), Offsets.Num());
+}
+
+static flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> CopyStringVector(
+	FFlatBufferBuilder& Builder,
+	const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>* Source)
+{
+	return CopyTableVector<flatbuffers::String>(Builder, Source,
+		[&Builder](const flatbuffers::String* Value, int32) { return CopyString(Builder, Value); });
+}
+
+static flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<GameScript::StringArray>>> CopyStringArrays(
+	FFlatBufferBuilder& Builder,
+	const flatbuffers::Vector<flatbuffers::Offset<GameScript::StringArray>>* Source)
+{
+	return CopyTableVector<GameScript::StringArray>(Builder, Source,
+		[&Builder](const GameScript::StringArray* Array, int32)
+		{
+			return GameScript::CreateStringArray(Builder, CopyStringVector(Builder, Array->values()));
+		});
+}
+
+// Works with both NodeProperty and ConversationProperty (identical union layout)
+template<typename TProperty>
+static flatbuffers::Offset<void> CopyPropertyValue(FFlatBufferBuilder& Builder, const TProperty* Property)
+{
+	switch (Property->value_type())
+	{
+	case GameScript::PropertyValue_string_val:
+		return CopyString(Builder, Property->value_as_string_val()).Union();
+
+	case GameScript::PropertyValue_int_val:
+		if (const GameScript::Int32Value* IntVal = Property->value_as_int_val())
+		{
+			return GameScript::CreateInt32Value(Builder, IntVal->value()).Union();
+		}
+		break;
+
+	case GameScript::PropertyValue_decimal_val:
+		if (const GameScript::FloatValue* FloatVal = Property->value_as_decimal_val())
+		{
+			return GameScript::CreateFloatValue(Builder, FloatVal->value()).Union();
+		}
+		break;
+
+	case GameScript::PropertyValue_bool_val:
+		if (const GameScript::BoolValue* BoolVal = Property->value_as_bool_val())
+		{
+			return GameScript::CreateBoolValue(Builder, BoolVal->value()).Union();
+		}
+		break;
+
+	default:
+		break;
+	}
+	return 0;
+}
+
+static flatbuffers::Offset<GameScript::Localization> CopyLocalization(
+	FFlatBufferBuilder& Builder,
+	const GameScript::Localization* Loc,
+	bool bIncludeVariants,
+	bool bIncludeKeyAndTags)
+{
+	flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<GameScript::TextVariant>>> Variants = 0;
+	if (bIncludeVariants)
+	{
+		Variants = CopyTableVector<GameScript::TextVariant>(Builder, Loc->variants(),
+			[&Builder](const GameScript::TextVariant* Variant, int32)
+			{
+				return GameScript::CreateTextVariant(Builder, Variant->plural(), Variant->gender(), CopyString(Builder, Variant->text()));
+			});
+	}
+
+	flatbuffers::Offset<flatbuffers::String> Name = bIncludeKeyAndTags ? CopyString(Builder, Loc->name()) : 0;
+	flatbuffers::Offset<flatbuffers::Vector<int32_t>> Tags = bIncludeKeyAndTags ? CopyIntVector(Builder, Loc->tag_indices()) : 0;
+
+	return GameScript::CreateLocalization(
+		Builder,
+		Loc->id(),
+		Name,
+		Loc->subject_actor_idx(),
+		Loc->subject_gender(),
+		Loc->is_templated(),
+		Variants,
+		Tags);
+}
+
+// --- FSnapshotWriter ---
+
+void FSnapshotWriter::WriteStructure(
+	const GameScript::Snapshot* Source,
+	TFunctionRef<bool(int32)> ShouldStripVariants,
+	TArray<uint8>& OutBuffer,
+	bool bKeepLocale)
+{
+	check(Source);
+
+	FFlatBufferBuilder Builder(1024 * 64);
+
+	auto LocaleName = bKeepLocale ? CopyString(Builder, Source->locale_name()) : 0;
+	auto ConversationTagNames = CopyStringVector(Builder, Source->conversation_tag_names());
+	auto ConversationTagValues = CopyStringArrays(Builder, Source->conversation_tag_values());
+
+	auto Conversations = CopyTableVector<GameScript::Conversation>(Builder, Source->conversations(),
+		[&Builder](const GameScript::Conversation* Conv, int32)
+		{
+			auto Name = CopyString(Builder, Conv->name());
+			auto Notes = CopyString(Builder, Conv->notes());
+			auto TagIndices = CopyIntVector(Builder, Conv->tag_indices());
+			auto Properties = CopyTableVector<GameScript::ConversationProperty>(Builder, Conv->properties(),
+				[&Builder](const GameScript::ConversationProperty* Prop, int32)
+				{
+					auto Value = CopyPropertyValue(Builder, Prop);
+					return GameScript::CreateConversationProperty(Builder, Prop->template_idx(), Prop->value_type(), Value);
+				});
+			auto NodeIndices = CopyIntVector(Builder, Conv->node_indices());
+			auto EdgeIndices = CopyIntVector(Builder, Conv->edge_indices());
+			return GameScript::CreateConversation(
+				Builder, Conv->id(), Name, Notes, Conv->is_layout_auto(), Conv->is_layout_vertical(),
+				TagIndices, Properties, NodeIndices, EdgeIndices, Conv->root_node_idx());
+		});
+
+	auto Nodes = CopyTableVector<GameScript::Node>(Builder, Source->nodes(),
+		[&Builder](const GameScript::Node* Node, int32)
+		{
+			auto Notes = CopyString(Builder, Node->notes());
+			auto Properties = CopyTableVector<GameScript::NodeProperty>(Builder, Node->properties(),
+				[&Builder](const GameScript::NodeProperty* Prop, int32)
+				{
+					auto Value = CopyPropertyValue(Builder, Prop);
+					return GameScript::CreateNodeProperty(Builder, Prop->template_idx(), Prop->value_type(), Value);
+				});
+			auto Outgoing = CopyIntVector(Builder, Node->outgoing_edge_indices());
+			auto Incoming = CopyIntVector(Builder, Node->incoming_edge_indices());
+			return GameScript::CreateNode(
+				Builder, Node->id(), Node->conversation_idx(), Node->type(), Node->actor_idx(),
+				Node->voice_text_idx(), Node->ui_response_text_idx(),
+				Node->has_condition(), Node->has_action(), Node->is_prevent_response(),
+				Node->position_x(), Node->position_y(), Notes, Properties, Outgoing, Incoming);
+		});
+
+	auto Edges = CopyTableVector<GameScript::Edge>(Builder, Source->edges(),
+		[&Builder](const GameScript::Edge* Edge, int32)
+		{
+			return GameScript::CreateEdge(
+				Builder, Edge->id(), Edge->conversation_idx(), Edge->source_idx(),
+				Edge->target_idx(), Edge->priority(), Edge->type());
+		});
+
+	auto Actors = CopyTableVector<GameScript::Actor>(Builder, Source->actors(),
+		[&Builder](const GameScript::Actor* Actor, int32)
+		{
+			auto Name = CopyString(Builder, Actor->name());
+			auto Color = CopyString(Builder, Actor->color());
+			return GameScript::CreateActor(
+				Builder, Actor->id(), Name, Color, Actor->grammatical_gender(), Actor->localized_name_idx());
+		});
+
+	auto LocalizationTagNames = CopyStringVector(Builder, Source->localization_tag_names());
+	auto LocalizationTagValues = CopyStringArrays(Builder, Source->localization_tag_values());
+
+	auto Localizations = CopyTableVector<GameScript::Localization>(Builder, Source->localizations(),
+		[&Builder, &ShouldStripVariants](const GameScript::Localization* Loc, int32 LocIdx)
+		{
+			return CopyLocalization(Builder, Loc, !ShouldStripVariants(LocIdx), true);
+		});
+
+	auto PropertyTemplates = CopyTableVector<GameScript::PropertyTemplate>(Builder, Source->property_templates(),
+		[&Builder](const GameScript::PropertyTemplate* Template, int32)
+		{
+			return GameScript::CreatePropertyTemplate(Builder, Template->id(), CopyString(Builder, Template->name()), Template->type());
+		});
+
+	auto Root = GameScript::CreateSnapshot(
+		Builder, bKeepLocale ? Source->locale_id() : 0, LocaleName,
+		ConversationTagNames, ConversationTagValues,
+		Conversations, Nodes, Edges, Actors,
+		LocalizationTagNames, LocalizationTagValues,
+		Localizations, PropertyTemplates);
+	GameScript::FinishSnapshotBuffer(Builder, Root);
+
+	OutBuffer.Reset();
+	OutBuffer.Append(Builder.GetBufferPointer(), Builder.GetSize());
+}
+
+void FSnapshotWriter::WriteTextBlock(
+	const GameScript::Snapshot* Source,
+	TConstArrayView<int32> LocalizationIndices,
+	TArray<uint8>& OutBuffer)
+{
+	check(Source && Source->localizations());
+
+	FFlatBufferBuilder Builder(1024 * 4);
+
+	TArray<flatbuffers::Offset<GameScript::Localization>> Offsets;
+	Offsets.Reserve(LocalizationIndices.Num());
+	for (int32 LocIdx : LocalizationIndices)
+	{
+		Offsets.Add(CopyLocalization(Builder, Source->localizations()->Get(LocIdx), true, false));
+	}
+	auto Localizations = Builder.CreateVector(Offsets.GetData(), Offsets.Num());
+	auto LocaleName = CopyString(Builder, Source->locale_name());
+
+	GameScript::SnapshotBuilder Root(Builder);
+	Root.add_locale_id(Source->locale_id());
+	Root.add_locale_name(LocaleName);
+	Root.add_localizations(Localizations);
+	GameScript::FinishSnapshotBuffer(Builder, Root.Finish());
+
+	OutBuffer.Reset();
+	OutBuffer.Append(Builder.GetBufferPointer(), Builder.GetSize());
+}
+
+#endif
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_EDITOR
+
+namespace GameScript { struct Snapshot; }
+
+/**
+ * Re-serializes loaded snapshots into derived FlatBuffers layouts.
+ * Editor-only: used by the packers that produce streaming containers from exported .gsb files.
+ *
+ * All output buffers are complete, verifiable Snapshot buffers (file identifier "GSP3"),
+ * so the runtime reads them with the same generated accessors as a regular snapshot.
+ */
+class FSnapshotWriter
+{
+public:
+	FSnapshotWriter() = delete;
+
+	/**
+	 * Copy a snapshot, dropping the text variants of selected localizations.
+	 * Index-stable: every entity keeps its position, so ID maps and jump tables built
+	 * against the copy match those built against the source.
+	 *
+	 * @param Source - Snapshot to copy
+	 * @param ShouldStripVariants - Predicate over localization index; true drops that entry's variants
+	 * @param OutBuffer - Receives the finished buffer
+	 * @param bKeepLocale - False omits locale_id/locale_name so every locale produces identical bytes
+	 */
+	static void WriteStructure(
+		const GameScript::Snapshot* Source,
+		TFunctionRef<bool(int32)> ShouldStripVariants,
+		TArray<uint8>& OutBuffer,
+		bool bKeepLocale = true);
+
+	/**
+	 * Write a text-only snapshot containing a subset of localizations.
+	 * Entries carry id, subject, templating flag and variants; keys and tags stay with the structure.
+	 * The locale id and name are carried over so a text block identifies its locale.
+	 *
+	 * @param Source - Snapshot to read localizations from
+	 * @param LocalizationIndices - Indices into Source->localizations() to include, in output order
+	 * @param OutBuffer - Receives the finished buffer
+	 */
+	static void WriteTextBlock(
+		const GameScript::Snapshot* Source,
+		TConstArrayView<int32> LocalizationIndices,
+		TArray<uint8>& OutBuffer);
+};
+
+#endif
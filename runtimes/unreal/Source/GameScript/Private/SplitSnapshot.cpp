@@ -0,0 +1,56 @@
+#include "SplitSnapshot.h"
+#include "Generated/snapshot_generated.h"
+
+#if WITH_EDITOR
+#include "SnapshotWriter.h"
+#endif
+
+namespace GameScriptSplit
+{
+	bool IsCompatible(const GameScript::Snapshot* Structure, const GameScript::Snapshot* StringTable)
+	{
+		const auto* StructureLocs = Structure ? Structure->localizations() : nullptr;
+		const auto* TableLocs = StringTable ? StringTable->localizations() : nullptr;
+		const int32 StructureCount = StructureLocs ? StructureLocs->size() : 0;
+		const int32 TableCount = TableLocs ? TableLocs->size() : 0;
+		if (StructureCount != TableCount)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < StructureCount; ++i)
+		{
+			if (StructureLocs->Get(i)->id() != TableLocs->Get(i)->id())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+#if WITH_EDITOR
+	bool Split(const TArray<uint8>& SnapshotData, TArray<uint8>& OutStructure, TArray<uint8>& OutStringTable)
+	{
+		flatbuffers::Verifier Verifier(SnapshotData.GetData(), SnapshotData.Num());
+		if (!GameScript::VerifySnapshotBuffer(Verifier))
+		{
+			return false;
+		}
+
+		const GameScript::Snapshot* Source = GameScript::GetSnapshot(SnapshotData.GetData());
+		const int32 LocalizationCount = Source->localizations() ? Source->localizations()->size() : 0;
+
+		FSnapshotWriter::WriteStructure(Source, [](int32) { return true; }, OutStructure, false);
+
+		TArray<int32> AllLocalizations;
+		AllLocalizations.Reserve(LocalizationCount);
+		for (int32 i = 0; i < LocalizationCount; ++i)
+		{
+			AllLocalizations.Add(i);
+		}
+		FSnapshotWriter::WriteTextBlock(Source, AllLocalizations, OutStringTable);
+
+		return true;
+	}
+#endif
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Paths.h"
+
+namespace GameScript { struct Snapshot; }
+
+/**
+ * Split snapshot layout: one shared structure plus a small string table per locale.
+ *
+ *   <BasePath>/structure.gss        - full Snapshot with every localization's variants stripped
+ *                                     and no locale identity (identical for all locales)
+ *   <BasePath>/locales/<Name>.gst   - text-only Snapshot (see FSnapshotWriter::WriteTextBlock)
+ *                                     holding every localization, in structure order
+ *
+ * Localization N of the string table is the text for localization N of the structure, so
+ * ID maps, jump tables and refs are built once against the structure. Changing locale loads
+ * only the new string table. Either file may be wrapped in a compressed container
+ * (see CompressedSnapshot.h).
+ */
+namespace GameScriptSplit
+{
+	/** Structure file name (in the snapshot base directory). */
+	inline const TCHAR* StructureFileName() { return TEXT("structure.gss"); }
+
+	/** File extension for per-locale string tables (in the locales directory). */
+	inline const TCHAR* StringTableExtension() { return TEXT(".gst"); }
+
+	/** Structure path for a snapshot base directory. */
+	inline FString GetStructurePath(const FString& BasePath)
+	{
+		return FPaths::Combine(BasePath, StructureFileName());
+	}
+
+	/** Structure path for a string table at <BasePath>/locales/<Name>.gst. */
+	inline FString GetStructurePathForStringTable(const FString& StringTablePath)
+	{
+		return GetStructurePath(FPaths::GetPath(FPaths::GetPath(StringTablePath)));
+	}
+
+	/**
+	 * Check that a string table lines up with a structure (same localization count and IDs by index).
+	 */
+	bool IsCompatible(const GameScript::Snapshot* Structure, const GameScript::Snapshot* StringTable);
+
+#if WITH_EDITOR
+	/**
+	 * Split an exported .gsb into its structure and string table (uncompressed).
+	 * Structures from different locales of the same export are byte-identical.
+	 * @return False if the source fails verification
+	 */
+	bool Split(const TArray<uint8>& SnapshotData, TArray<uint8>& OutStructure, TArray<uint8>& OutStringTable);
+#endif
+}
@@ -0,0 +1,171 @@
+#include "TagIndex.h"
+
+FGSTagQuery& FGSTagQuery::Where(const FString& Category, const FString& Value)
+{
+	FTerm& Term = Terms.AddDefaulted_GetRef();
+	Term.Category = Category;
+	Term.Values.Add(Value);
+	return *this;
+}
+
+FGSTagQuery& FGSTagQuery::WhereAny(const FString& Category, TArray<FString> Values)
+{
+	FTerm& Term = Terms.AddDefaulted_GetRef();
+	Term.Category = Category;
+	Term.Values = MoveTemp(Values);
+	return *this;
+}
+
+int32 FGSTagIndex::AddCategory(const FString& Name, const TArray<FString>& Values)
+{
+	const int32 CategoryIndex = Categories.Num();
+	FCategory& Category = Categories.AddDefaulted_GetRef();
+	Category.Name = Name;
+	Category.Values.SetNum(Values.Num());
+	for (int32 i = 0; i < Values.Num(); ++i)
+	{
+		// First wins on duplicate names
+		if (!Category.ValueToIndex.Contains(Values[i]))
+		{
+			Category.ValueToIndex.Add(Values[i], i);
+		}
+	}
+	if (!CategoryToIndex.Contains(Name))
+	{
+		CategoryToIndex.Add(Name, CategoryIndex);
+	}
+	return CategoryIndex;
+}
+
+void FGSTagIndex::Add(int32 Category, int32 Value, int32 EntityIndex)
+{
+	if (Categories.IsValidIndex(Category) && Categories[Category].Values.IsValidIndex(Value))
+	{
+		// Entities are added in index order, so the array stays sorted
+		Categories[Category].Values[Value].Indices.Add(EntityIndex);
+	}
+}
+
+void FGSTagIndex::Finalize(int32 InEntityCount)
+{
+	EntityCount = InEntityCount;
+	WordCount = (EntityCount + 63) / 64;
+
+	for (FCategory& Category : Categories)
+	{
+		for (FContainer& Container : Category.Values)
+		{
+			Container.Count = Container.Indices.Num();
+
+			// Dense once the bitmap is smaller than the array (4 bytes per entry vs. 1 bit per entity)
+			if (static_cast<int64>(Container.Count) * 32 > static_cast<int64>(WordCount) * 64)
+			{
+				Container.Words.SetNumZeroed(WordCount);
+				for (int32 EntityIndex : Container.Indices)
+				{
+					Container.Words[EntityIndex >> 6] |= uint64(1) << (EntityIndex & 63);
+				}
+				Container.Indices.Empty();
+			}
+			else
+			{
+				Container.Indices.Shrink();
+			}
+		}
+	}
+}
+
+const FGSTagIndex::FContainer* FGSTagIndex::FindContainer(const FCategory& Category, const FString& Value) const
+{
+	const int32* ValueIndex = Category.ValueToIndex.Find(Value);
+	return ValueIndex ? &Category.Values[*ValueIndex] : nullptr;
+}
+
+void FGSTagIndex::OrInto(TArray<uint64>& Words, const FContainer& Container)
+{
+	if (Container.Words.Num() > 0)
+	{
+		uint64* RESTRICT Dest = Words.GetData();
+		const uint64* RESTRICT Source = Container.Words.GetData();
+		for (int32 i = 0; i < Words.Num(); ++i)
+		{
+			Dest[i] |= Source[i];
+		}
+		return;
+	}
+
+	for (int32 EntityIndex : Container.Indices)
+	{
+		Words[EntityIndex >> 6] |= uint64(1) << (EntityIndex & 63);
+	}
+}
+
+void FGSTagIndex::Query(const FGSTagQuery& Query, TArray<int32>& OutIndices) const
+{
+	OutIndices.Reset();
+
+	if (Query.Terms.Num() == 0)
+	{
+		OutIndices.Reserve(EntityCount);
+		for (int32 i = 0; i < EntityCount; ++i)
+		{
+			OutIndices.Add(i);
+		}
+		return;
+	}
+
+	TArray<uint64> Result;
+	TArray<uint64> Term;
+	for (int32 t = 0; t < Query.Terms.Num(); ++t)
+	{
+		const FGSTagQuery::FTerm& QueryTerm = Query.Terms[t];
+		const int32* CategoryIndex = CategoryToIndex.Find(QueryTerm.Category);
+		if (!CategoryIndex)
+		{
+			return;
+		}
+
+		// First term ORs straight into the result
+		TArray<uint64>& Target = t == 0 ? Result : Term;
+		Target.Reset();
+		Target.SetNumZeroed(WordCount);
+		bool bAnyValue = false;
+		for (const FString& Value : QueryTerm.Values)
+		{
+			if (const FContainer* Container = FindContainer(Categories[*CategoryIndex], Value))
+			{
+				OrInto(Target, *Container);
+				bAnyValue = true;
+			}
+		}
+		if (!bAnyValue)
+		{
+			return;
+		}
+
+		if (t > 0)
+		{
+			uint64* RESTRICT Dest = Result.GetData();
+			const uint64* RESTRICT Source = Term.GetData();
+			for (int32 i = 0; i < WordCount; ++i)
+			{
+				Dest[i] &= Source[i];
+			}
+		}
+	}
+
+	for (int32 w = 0; w < WordCount; ++w)
+	{
+		for (uint64 Word = Result[w]; Word != 0; Word &= Word - 1)
+		{
+			OutIndices.Add((w << 6) + static_cast<int32>(FMath::CountTrailingZeros64(Word)));
+		}
+	}
+}
+
+int32 FGSTagIndex::CountTagged(const FString& Category, const FString& Value) const
+{
+	const int32* CategoryIndex = CategoryToIndex.Find(Category);
+	const FContainer* Container = CategoryIndex ? FindContainer(Categories[*CategoryIndex], Value) : nullptr;
+	return Container ? Container->Count : 0;
+}
@@ -0,0 +1,119 @@
+#include "GSTestSnapshot.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Generated/snapshot_generated.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace GameScriptTests
+{
+	using FFlatBufferBuilder = flatbuffers::FlatBufferBuilder;
+
+	static flatbuffers::Offset<flatbuffers::String> MakeString(FFlatBufferBuilder& Builder, const FString& Value)
+	{
+		const FTCHARToUTF8 Utf8(*Value);
+		return Builder.CreateString(Utf8.Get(), Utf8.Length());
+	}
+
+	static flatbuffers::Offset<flatbuffers::Vector<int32_t>> MakeIndexVector(FFlatBufferBuilder& Builder, int32 Index)
+	{
+		return Index != INDEX_NONE ? Builder.CreateVector(&Index, 1) : 0;
+	}
+
+	FTestSnapshotBuilder& FTestSnapshotBuilder::AddChain(int32 ConversationId, int32 NodeCount)
+	{
+		Chains.Add({ ConversationId, NodeCount });
+		return *this;
+	}
+
+	FTestSnapshotBuilder& FTestSnapshotBuilder::SetTextSuffix(const FString& Suffix)
+	{
+		TextSuffix = Suffix;
+		return *this;
+	}
+
+	FString FTestSnapshotBuilder::LineText(int32 ConversationId, int32 Position)
+	{
+		return FString::Printf(TEXT("Conversation %d line %d"), ConversationId, Position);
+	}
+
+	void FTestSnapshotBuilder::Build(TArray<uint8>& OutBuffer) const
+	{
+		FFlatBufferBuilder Builder(1024 * 4);
+
+		TArray<flatbuffers::Offset<GameScript::Conversation>> Conversations;
+		TArray<flatbuffers::Offset<GameScript::Node>> Nodes;
+		TArray<flatbuffers::Offset<GameScript::Edge>> Edges;
+		TArray<flatbuffers::Offset<GameScript::Localization>> Localizations;
+
+		for (int32 ConvIdx = 0; ConvIdx < Chains.Num(); ++ConvIdx)
+		{
+			const FChain& Chain = Chains[ConvIdx];
+			const int32 FirstNode = Nodes.Num();
+			const int32 FirstEdge = Edges.Num();
+
+			// Edge i links position i to position i + 1
+			TArray<int32> NodeIndices;
+			TArray<int32> EdgeIndices;
+			for (int32 Position = 0; Position <= Chain.NodeCount; ++Position)
+			{
+				const int32 Id = NodeId(Chain.ConversationId, Position);
+				const bool bRoot = Position == 0;
+
+				int32 VoiceTextIdx = -1;
+				if (!bRoot)
+				{
+					auto Text = MakeString(Builder, LineText(Chain.ConversationId, Position) + TextSuffix);
+					auto Variant = GameScript::CreateTextVariant(Builder, GameScript::PluralCategory_Other, GameScript::GenderCategory_Other, Text);
+					auto Variants = Builder.CreateVector(&Variant, 1);
+					VoiceTextIdx = Localizations.Num();
+					Localizations.Add(GameScript::CreateLocalization(Builder, Id, 0, -1, GameScript::GenderCategory_Other, false, Variants));
+				}
+
+				auto Outgoing = MakeIndexVector(Builder, Position < Chain.NodeCount ? FirstEdge + Position : INDEX_NONE);
+				auto Incoming = MakeIndexVector(Builder, bRoot ? INDEX_NONE : FirstEdge + Position - 1);
+				NodeIndices.Add(Nodes.Num());
+				Nodes.Add(GameScript::CreateNode(
+					Builder, Id, ConvIdx, bRoot ? GameScript::NodeType_Root : GameScript::NodeType_Dialogue, -1,
+					VoiceTextIdx, -1, false, false, false, 0.0f, 0.0f, 0, 0, Outgoing, Incoming));
+			}
+
+			for (int32 Position = 0; Position < Chain.NodeCount; ++Position)
+			{
+				EdgeIndices.Add(Edges.Num());
+				Edges.Add(GameScript::CreateEdge(
+					Builder, NodeId(Chain.ConversationId, Position), ConvIdx, FirstNode + Position, FirstNode + Position + 1));
+			}
+
+			auto Name = MakeString(Builder, FString::Printf(TEXT("Conversation %d"), Chain.ConversationId));
+			auto NodeIndexVector = Builder.CreateVector(NodeIndices.GetData(), NodeIndices.Num());
+			auto EdgeIndexVector = Builder.CreateVector(EdgeIndices.GetData(), EdgeIndices.Num());
+			Conversations.Add(GameScript::CreateConversation(
+				Builder, Chain.ConversationId, Name, 0, false, false, 0, 0, NodeIndexVector, EdgeIndexVector, FirstNode));
+		}
+
+		auto LocaleName = MakeString(Builder, TEXT("en_US"));
+		auto ConversationVector = Builder.CreateVector(Conversations.GetData(), Conversations.Num());
+		auto NodeVector = Builder.CreateVector(Nodes.GetData(), Nodes.Num());
+		auto EdgeVector = Builder.CreateVector(Edges.GetData(), Edges.Num());
+		auto LocalizationVector = Builder.CreateVector(Localizations.GetData(), Localizations.Num());
+
+		auto Root = GameScript::CreateSnapshot(
+			Builder, 1, LocaleName, 0, 0, ConversationVector, NodeVector, EdgeVector, 0, 0, 0, LocalizationVector, 0);
+		GameScript::FinishSnapshotBuffer(Builder, Root);
+
+		OutBuffer.Reset();
+		OutBuffer.Append(Builder.GetBufferPointer(), Builder.GetSize());
+	}
+
+	FString FTestSnapshotBuilder::WriteTempFile(const FString& FileName, const TArray<uint8>& Data)
+	{
+		const FString Path = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("GameScript") / FileName);
+		FFileHelper::SaveArrayToFile(Data, *Path);
+		return Path;
+	}
+}
+
+#endif
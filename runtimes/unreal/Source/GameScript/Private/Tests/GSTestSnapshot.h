@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace GameScriptTests
+{
+	/**
+	 * Builds small snapshots for automation tests.
+	 *
+	 * Each conversation is a root followed by a chain of dialogue nodes (one edge each, so the runner
+	 * auto-advances), and every dialogue node has its own voice text. Node and localization IDs are
+	 * NodeId(ConversationId, Position), with the root at position 0.
+	 */
+	class FTestSnapshotBuilder
+	{
+	public:
+		/** Add a conversation with NodeCount dialogue nodes after the root. */
+		FTestSnapshotBuilder& AddChain(int32 ConversationId, int32 NodeCount);
+
+		/** Append Suffix to every line (the same structure with different text). */
+		FTestSnapshotBuilder& SetTextSuffix(const FString& Suffix);
+
+		/** Serialize to a verifiable Snapshot buffer. */
+		void Build(TArray<uint8>& OutBuffer) const;
+
+		static int32 NodeId(int32 ConversationId, int32 Position) { return ConversationId * 100000 + Position; }
+
+		/** Text of a dialogue node's voice line. */
+		static FString LineText(int32 ConversationId, int32 Position);
+
+		/** Write a file to the automation temp directory, replacing it. @return Full path */
+		static FString WriteTempFile(const FString& FileName, const TArray<uint8>& Data);
+
+	private:
+		struct FChain
+		{
+			int32 ConversationId;
+			int32 NodeCount;
+		};
+
+		TArray<FChain> Chains;
+		FString TextSuffix;
+	};
+}
+
+#endif
@@ -0,0 +1,110 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "GSTestSnapshot.h"
+#include "GameScriptDatabase.h"
+#include "GameScriptLoader.h"
+#include "GameScriptManifest.h"
+#include "SnapshotPatch.h"
+#include "SplitSnapshot.h"
+#include "Sha256.h"
+#include "Generated/snapshot_generated.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSPatchThenHotReloadTest, "GameScript.Patch.SplitLocaleThenHotReload",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSPatchThenHotReloadTest::RunTest(const FString& Parameters)
+{
+	using GameScriptTests::FTestSnapshotBuilder;
+
+	TArray<uint8> Base;
+	TArray<uint8> Patched;
+	TArray<uint8> Reloaded;
+	FTestSnapshotBuilder().AddChain(1, 4).Build(Base);
+	FTestSnapshotBuilder().AddChain(1, 4).SetTextSuffix(TEXT(" (patched)")).Build(Patched);
+	FTestSnapshotBuilder().AddChain(1, 4).SetTextSuffix(TEXT(" (reloaded)")).Build(Reloaded);
+
+	// A split export, plus the uncompressed .gsb that patches apply to
+	TArray<uint8> Structure;
+	TArray<uint8> StringTable;
+	if (!TestTrue(TEXT("Split"), GameScriptSplit::Split(Base, Structure, StringTable)))
+	{
+		return false;
+	}
+
+	const FString LocaleName = TEXT("gs_patch_test");
+	const FString Dir = FPaths::ConvertRelativePathToFull(FPaths::AutomationTransientDir() / TEXT("GameScript") / TEXT("PatchReload"));
+	const FString LocalePath = Dir / TEXT("locales") / LocaleName;
+	FFileHelper::SaveArrayToFile(Base, *(LocalePath + TEXT(".gsb")));
+	FFileHelper::SaveArrayToFile(StringTable, *(LocalePath + GameScriptSplit::StringTableExtension()));
+	FFileHelper::SaveArrayToFile(Structure, *GameScriptSplit::GetStructurePath(Dir));
+	FFileHelper::SaveStringToFile(FString::Printf(
+		TEXT("{ \"primaryLocale\": 0, \"locales\": [ { \"id\": 1, \"name\": \"%s\", \"localizedName\": \"Test\", \"hash\": \"%s\" } ] }"),
+		*LocaleName, *FGSSha256::HashHex(Patched)), *(Dir / TEXT("manifest.json")));
+
+	UGameScriptManifest* Manifest = UGameScriptLoader::LoadManifest(Dir);
+	if (!TestNotNull(TEXT("Manifest"), Manifest))
+	{
+		return false;
+	}
+
+	// Start from the split layout, not a patch left behind by an earlier run
+	IFileManager& FileManager = IFileManager::Get();
+	const FString InstalledPath = Manifest->GetPatchedSnapshotPath(0);
+	FileManager.Delete(*InstalledPath);
+	FileManager.Delete(*(InstalledPath + TEXT(".hash")));
+
+	const FLocaleRef Locale(Manifest, 0);
+	UGameScriptDatabase* Database = Manifest->LoadDatabase(Locale);
+	if (!TestNotNull(TEXT("Database"), Database))
+	{
+		return false;
+	}
+
+	auto FirstLine = [Database]()
+	{
+		const GameScript::Localization* Text = Database->GetLocalizationText(0);
+		return Text ? FString(UTF8_TO_TCHAR(Text->variants()->Get(0)->text()->c_str())) : FString();
+	};
+	TestEqual(TEXT("Shipped text"), FirstLine(), FTestSnapshotBuilder::LineText(1, 1));
+
+	TArray<uint8> Patch;
+	GameScriptPatch::Create(Base, Patched, Patch);
+	TestTrue(TEXT("Apply"), Database->ApplySnapshotPatch(Locale, FTestSnapshotBuilder::WriteTempFile(TEXT("PatchReload.gsd"), Patch)));
+	TestEqual(TEXT("Patched text"), FirstLine(), FTestSnapshotBuilder::LineText(1, 1) + TEXT(" (patched)"));
+
+	// Re-export over the installed patch; hot reload polls on the core ticker, so wait across frames
+	Manifest->AddToRoot();
+	Database->AddToRoot();
+	Database->SetRuntimeHotReloadEnabled(true);
+	FFileHelper::SaveArrayToFile(Reloaded, *InstalledPath);
+	FileManager.SetTimeStamp(*InstalledPath, FDateTime::UtcNow() + FTimespan::FromMinutes(1));
+
+	const FString Expected = FTestSnapshotBuilder::LineText(1, 1) + TEXT(" (reloaded)");
+	const double Deadline = FPlatformTime::Seconds() + 10.0;
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, Manifest, Database, FirstLine, Expected, Deadline, InstalledPath]()
+	{
+		if (FirstLine() != Expected && FPlatformTime::Seconds() < Deadline)
+		{
+			return false;
+		}
+
+		TestEqual(TEXT("Hot-reloaded text"), FirstLine(), Expected);
+		Database->SetRuntimeHotReloadEnabled(false);
+		Database->RemoveFromRoot();
+		Manifest->RemoveFromRoot();
+		IFileManager::Get().Delete(*InstalledPath);
+		IFileManager::Get().Delete(*(InstalledPath + TEXT(".hash")));
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
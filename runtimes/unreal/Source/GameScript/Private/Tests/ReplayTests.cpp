@@ -0,0 +1,77 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "GSTestSnapshot.h"
+#include "GameScriptDatabase.h"
+#include "GameScriptRunner.h"
+#include "GameScriptSettings.h"
+#include "ConversationRecorder.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSReplayLongRecordingTest, "GameScript.Replay.LongRecording",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSReplayLongRecordingTest::RunTest(const FString& Parameters)
+{
+	using GameScriptTests::FTestSnapshotBuilder;
+
+	// Long enough to overflow the stack if each completion entered the next node inline
+	static constexpr int32 NodeCount = 5000;
+	static constexpr int32 ConversationId = 1;
+
+	TArray<uint8> Source;
+	FTestSnapshotBuilder().AddChain(ConversationId, NodeCount).Build(Source);
+
+	UGameScriptDatabase* Database = NewObject<UGameScriptDatabase>();
+	if (!TestTrue(TEXT("Load"), Database->LoadSnapshot(FTestSnapshotBuilder::WriteTempFile(TEXT("LongReplay.gsb"), Source))))
+	{
+		return false;
+	}
+
+	UGameScriptSettings* Settings = NewObject<UGameScriptSettings>();
+	Settings->ConversationRecorderCapacity = 1 << 16;
+	UGameScriptRunner* Runner = NewObject<UGameScriptRunner>();
+	Runner->Initialize(Database, Settings);
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+	AActor* TaskOwner = World->SpawnActor<AActor>();
+
+	// A chain has no conditions or choices: the recording is just its start
+	TArray<FGSRecordedEvent> Events;
+	FGSRecordedEvent& Start = Events.AddDefaulted_GetRef();
+	Start.Type = EGSRecordedEvent::Start;
+	Start.ContextId = 0;
+	Start.Value = ConversationId;
+
+	const FActiveConversation Handle = Runner->ReplayConversation(Events, 0, TaskOwner);
+	TestTrue(TEXT("Replay started"), Runner->IsActive(Handle));
+
+	// Each completion is a game-thread task; pump until the conversation has run out
+	for (int32 Pass = 0; Pass < NodeCount * 10 && Runner->IsActive(Handle); ++Pass)
+	{
+		FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+	}
+	TestFalse(TEXT("Replay finished"), Runner->IsActive(Handle));
+
+	// The replay reached the last node of the chain
+	TArray<FGSRecordedEvent> Recorded;
+	Runner->GetRecorder().GetEvents(Recorded);
+	const int32 LastNodeId = FTestSnapshotBuilder::NodeId(ConversationId, NodeCount);
+	TestTrue(TEXT("Last node entered"), Recorded.ContainsByPredicate([LastNodeId](const FGSRecordedEvent& Event)
+	{
+		return Event.Type == EGSRecordedEvent::State && Event.NodeId == LastNodeId;
+	}));
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+	return true;
+}
+
+#endif
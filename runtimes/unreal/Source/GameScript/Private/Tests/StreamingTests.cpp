@@ -0,0 +1,134 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "GSTestSnapshot.h"
+#include "GameScriptDatabase.h"
+#include "ChunkedSnapshot.h"
+#include "TextResolver.h"
+#include "Generated/snapshot_generated.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSStreamingBudgetTest, "GameScript.Streaming.BudgetSmallerThanTwoBlocks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSStreamingBudgetTest::RunTest(const FString& Parameters)
+{
+	using GameScriptTests::FTestSnapshotBuilder;
+
+	// Two conversations of four lines: one streamed block each
+	TArray<uint8> Source;
+	FTestSnapshotBuilder().AddChain(1, 4).AddChain(2, 4).Build(Source);
+
+	TArray<uint8> Packed;
+	int32 BlockCount = 0;
+	if (!TestTrue(TEXT("Pack"), GameScriptChunked::Pack(Source, Packed, BlockCount)))
+	{
+		return false;
+	}
+	TestEqual(TEXT("Block count"), BlockCount, 2);
+
+	UGameScriptDatabase* Database = NewObject<UGameScriptDatabase>();
+	if (!TestTrue(TEXT("Load"), Database->LoadSnapshot(FTestSnapshotBuilder::WriteTempFile(TEXT("StreamingBudget.gsc"), Packed))))
+	{
+		return false;
+	}
+
+	// Smaller than even one block: every commit is over budget
+	Database->SetStreamingBudget(1);
+
+	// Localizations are in node order: conversation 1 owns 0-3, conversation 2 owns 4-7
+	const GameScript::Localization* First = Database->GetLocalizationText(0);
+	if (!TestNotNull(TEXT("Text of the block being faulted in"), First))
+	{
+		return false;
+	}
+	TestEqual(TEXT("First line"), FString(UTF8_TO_TCHAR(First->variants()->Get(0)->text()->c_str())),
+		FTestSnapshotBuilder::LineText(1, 1));
+	TestTrue(TEXT("Faulted-in block stays resident"), Database->IsConversationResident(1));
+
+	// Faulting in the second block evicts the first, never itself
+	TestNotNull(TEXT("Text of the second block"), Database->GetLocalizationText(4));
+	TestTrue(TEXT("Second block resident"), Database->IsConversationResident(2));
+	TestFalse(TEXT("First block evicted"), Database->IsConversationResident(1));
+
+	// A pinned block is kept alongside the block being faulted in
+	Database->PinConversation(1);
+	TestNotNull(TEXT("Text of a pinned block"), Database->GetLocalizationText(1));
+	TestNotNull(TEXT("Text after the pinned block was loaded"), Database->GetLocalizationText(5));
+	TestTrue(TEXT("Pinned block resident"), Database->IsConversationResident(1));
+	TestTrue(TEXT("Latest block resident"), Database->IsConversationResident(2));
+
+	// Unpinning makes the block evictable again
+	Database->UnpinConversation(1);
+	TestFalse(TEXT("Unpinned block evicted"), Database->IsConversationResident(1));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSStreamingResolverEvictionTest, "GameScript.Streaming.ResolverOutlivesEviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSStreamingResolverEvictionTest::RunTest(const FString& Parameters)
+{
+	using GameScriptTests::FTestSnapshotBuilder;
+
+	TArray<uint8> Source;
+	FTestSnapshotBuilder().AddChain(1, 4).AddChain(2, 4).Build(Source);
+
+	TArray<uint8> Packed;
+	int32 BlockCount = 0;
+	UGameScriptDatabase* Database = NewObject<UGameScriptDatabase>();
+	if (!TestTrue(TEXT("Pack"), GameScriptChunked::Pack(Source, Packed, BlockCount))
+		|| !TestTrue(TEXT("Load"), Database->LoadSnapshot(FTestSnapshotBuilder::WriteTempFile(TEXT("ResolverEviction.gsc"), Packed))))
+	{
+		return false;
+	}
+
+	// Capture conversation 1 while resident, then evict it
+	Database->SetStreamingBudget(1);
+	TestNotNull(TEXT("Fault in the first block"), Database->GetLocalizationText(0));
+	TSharedRef<const FGSTextResolver, ESPMode::ThreadSafe> Resolver = Database->CreateTextResolver();
+	TestNotNull(TEXT("Fault in the second block"), Database->GetLocalizationText(4));
+	TestFalse(TEXT("First block evicted"), Database->IsConversationResident(1));
+
+	// The resolver still holds the evicted block's text
+	TestEqual(TEXT("Text after eviction"), Resolver->ResolveText(0, FTextResolutionParams()), FTestSnapshotBuilder::LineText(1, 1));
+	TestTrue(TEXT("Conversation not resident at creation"), Resolver->ResolveText(4, FTextResolutionParams()).IsEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSStreamingCorruptHeaderTest, "GameScript.Streaming.CorruptHeaderCounts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSStreamingCorruptHeaderTest::RunTest(const FString& Parameters)
+{
+	using GameScriptTests::FTestSnapshotBuilder;
+
+	TArray<uint8> Source;
+	FTestSnapshotBuilder().AddChain(1, 4).Build(Source);
+
+	TArray<uint8> Packed;
+	int32 BlockCount = 0;
+	if (!TestTrue(TEXT("Pack"), GameScriptChunked::Pack(Source, Packed, BlockCount)))
+	{
+		return false;
+	}
+
+	// BlockCount and LocalizationCount follow Magic and Version
+	for (int32 CountOffset : { 8, 12 })
+	{
+		TArray<uint8> Corrupt = Packed;
+		FMemory::Memset(Corrupt.GetData() + CountOffset, 0xFF, sizeof(uint32));
+
+		AddExpectedError(TEXT("Chunked snapshot tables exceed the file"), EAutomationExpectedErrorFlags::Contains, 1);
+		UGameScriptDatabase* Database = NewObject<UGameScriptDatabase>();
+		TestFalse(FString::Printf(TEXT("Load with count at offset %d corrupted"), CountOffset),
+			Database->LoadSnapshot(FTestSnapshotBuilder::WriteTempFile(TEXT("CorruptHeader.gsc"), Corrupt)));
+	}
+
+	return true;
+}
+
+#endif
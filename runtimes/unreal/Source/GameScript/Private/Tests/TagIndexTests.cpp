@@ -0,0 +1,50 @@
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "TagIndex.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGSTagIndexCaseTest, "GameScript.Tags.CaseSensitiveNames",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FGSTagIndexCaseTest::RunTest(const FString& Parameters)
+{
+	// Same layout as the Godot fixture (res://test/tag_fixture):
+	// 0 Region=Docks Type=Bark, 1 Region=docks, 2 Region=Market Type=Bark, 3 untagged
+	FGSTagIndex Index;
+	const int32 Region = Index.AddCategory(TEXT("Region"), { TEXT("Docks"), TEXT("docks"), TEXT("Market") });
+	const int32 Type = Index.AddCategory(TEXT("Type"), { TEXT("Bark") });
+	Index.Add(Region, 0, 0);
+	Index.Add(Type, 0, 0);
+	Index.Add(Region, 1, 1);
+	Index.Add(Region, 2, 2);
+	Index.Add(Type, 0, 2);
+	Index.Finalize(4);
+
+	TArray<int32> Result;
+	Index.Query(FGSTagQuery().Where(TEXT("Region"), TEXT("Docks")), Result);
+	TestTrue(TEXT("Exact value"), Result == TArray<int32>({ 0 }));
+
+	Index.Query(FGSTagQuery().Where(TEXT("Region"), TEXT("docks")), Result);
+	TestTrue(TEXT("Values differing only in case are distinct"), Result == TArray<int32>({ 1 }));
+
+	Index.Query(FGSTagQuery().Where(TEXT("Region"), TEXT("DOCKS")), Result);
+	TestEqual(TEXT("Value in another case"), Result.Num(), 0);
+
+	Index.Query(FGSTagQuery().Where(TEXT("region"), TEXT("Docks")), Result);
+	TestEqual(TEXT("Category in another case"), Result.Num(), 0);
+
+	Index.Query(FGSTagQuery().WhereAny(TEXT("Region"), { TEXT("Docks"), TEXT("docks") }), Result);
+	TestTrue(TEXT("Both cases listed"), Result == TArray<int32>({ 0, 1 }));
+
+	Index.Query(FGSTagQuery().Where(TEXT("Region"), TEXT("Market")).Where(TEXT("Type"), TEXT("Bark")), Result);
+	TestTrue(TEXT("Categories AND"), Result == TArray<int32>({ 2 }));
+
+	TestEqual(TEXT("Count of exact value"), Index.CountTagged(TEXT("Region"), TEXT("docks")), 1);
+	TestEqual(TEXT("Count of value in another case"), Index.CountTagged(TEXT("Region"), TEXT("DOCKS")), 0);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,224 @@
+#include "TextPrefetch.h"
+#include "GameScriptDatabase.h"
+#include "IGameScriptListener.h"
+#include "IGameScriptNativeListener.h"
+#include "Generated/snapshot_generated.h"
+#include "Async/Async.h"
+
+void FGSTextPrefetch::Prefetch(UGameScriptRunner* Runner, UObject* Listener, IGameScriptNativeListener* NativeListener, FNodeRef From, int32 Depth)
+{
+	// Keep the previous batch around for reuse: its params always, its text once it has finished
+	// (an unfinished task just runs out)
+	TSharedPtr<FBatch, ESPMode::ThreadSafe> Previous = Batch;
+	const bool bPreviousResolved = Batch && BatchTask.IsReady();
+	Retire();
+
+	if (Depth <= 0 || !From.IsValid() || !Listener)
+	{
+		return;
+	}
+
+	UGameScriptDatabase* Database = Runner->GetDatabase();
+	TSharedRef<FBatch, ESPMode::ThreadSafe> NewBatch = MakeShared<FBatch, ESPMode::ThreadSafe>();
+	NewBatch->Snapshot = Database->GetSnapshot();
+	NewBatch->Format = Runner->GetLocaleFormat(Database->GetCurrentLocale());
+
+	// Lines already in the look-ahead keep their params, so the listener is asked only about nodes
+	// new to it (the task never writes params; the runner compares them again before using a line)
+	TMap<int32, const FLine*> PreviousLines;
+	if (Previous)
+	{
+		PreviousLines.Reserve(Previous->Lines.Num());
+		for (const FLine& Line : Previous->Lines)
+		{
+			PreviousLines.Add(Line.NodeIndex, &Line);
+		}
+	}
+
+	auto Gather = [Database, bPreviousResolved](int32 LocalizationIdx, const FPrefetchedText* Known,
+		TFunctionRef<FTextResolutionParams()> QueryParms, FPrefetchedText& Out)
+	{
+		const bool bKnown = Known && Known->LocalizationIdx == LocalizationIdx;
+		Out.LocalizationIdx = LocalizationIdx;
+		Out.Parms = bKnown ? Known->Parms : QueryParms();
+
+		// Same line, same params: the previous batch already did the work
+		if (bKnown && bPreviousResolved && Known->bResolved)
+		{
+			Out.Text = Known->Text;
+			Out.bResolved = true;
+			return;
+		}
+
+		// Pointer lookup stays on the game thread (it may fault in a streamed block)
+		Out.Localization = Database->GetLocalizationText(LocalizationIdx);
+	};
+
+	// Breadth-first over the likely path, never past MaxLines
+	TArray<FNodeRef> Frontier = { From };
+	TArray<FNodeRef> Next;
+	TSet<int32> Visited = { From.Index };
+	for (int32 Level = 0; Level < Depth && Frontier.Num() > 0 && NewBatch->Lines.Num() < MaxLines; ++Level)
+	{
+		Next.Reset();
+		for (FNodeRef Node : Frontier)
+		{
+			const int32 EdgeCount = Node.GetOutgoingEdgeCount();
+			int32 HighestPriority = TNumericLimits<int32>::Min();
+			for (int32 i = 0; i < EdgeCount; ++i)
+			{
+				FEdgeRef Edge = Node.GetOutgoingEdge(i);
+				if (Edge.IsValid())
+				{
+					HighestPriority = FMath::Max(HighestPriority, Edge.GetPriority());
+				}
+			}
+
+			for (int32 i = 0; i < EdgeCount && NewBatch->Lines.Num() < MaxLines; ++i)
+			{
+				FEdgeRef Edge = Node.GetOutgoingEdge(i);
+				FNodeRef Target = Edge.IsValid() ? Edge.GetTarget() : FNodeRef();
+				if (!Target.IsValid() || (Target.HasCondition() && Edge.GetPriority() != HighestPriority))
+				{
+					continue;
+				}
+				if (Visited.Contains(Target.Index))
+				{
+					continue;
+				}
+				Visited.Add(Target.Index);
+				Next.Add(Target);
+
+				FLine& Line = NewBatch->Lines.AddDefaulted_GetRef();
+				Line.NodeIndex = Target.Index;
+				const FLine* Known = PreviousLines.FindRef(Target.Index);
+
+				const int32 VoiceIdx = Target.GetVoiceTextLocalizationIdx();
+				if (VoiceIdx >= 0)
+				{
+					Gather(VoiceIdx, Known ? &Known->Voice : nullptr, [&]()
+					{
+						const FLocalizationRef LocRef(Database, VoiceIdx);
+						return NativeListener
+							? NativeListener->OnSpeechParams(LocRef, Target)
+							: IGameScriptListener::Execute_OnSpeechParams(Listener, LocRef, Target);
+					}, Line.Voice);
+				}
+
+				const int32 UIIdx = Target.GetUIResponseTextLocalizationIdx();
+				if (UIIdx >= 0)
+				{
+					Gather(UIIdx, Known ? &Known->UIResponse : nullptr, [&]()
+					{
+						const FLocalizationRef LocRef(Database, UIIdx);
+						return NativeListener
+							? NativeListener->OnDecisionParams(LocRef, Target)
+							: IGameScriptListener::Execute_OnDecisionParams(Listener, LocRef, Target);
+					}, Line.UIResponse);
+				}
+			}
+		}
+		Swap(Frontier, Next);
+	}
+
+	if (NewBatch->Lines.Num() == 0)
+	{
+		return;
+	}
+
+	Batch = NewBatch;
+	BatchTask = Async(EAsyncExecution::ThreadPool, [NewBatch]()
+	{
+		FString Scratch;
+		auto Resolve = [&NewBatch, &Scratch](FPrefetchedText& Text)
+		{
+			if (!Text.bResolved && Text.Localization)
+			{
+				Text.Text = FGSTextResolver::ResolveLocalization(
+					Text.Localization, NewBatch->Snapshot, Text.Parms, NewBatch->Format, Scratch);
+				Text.bResolved = true;
+			}
+		};
+
+		for (FLine& Line : NewBatch->Lines)
+		{
+			Resolve(Line.Voice);
+			Resolve(Line.UIResponse);
+		}
+	});
+}
+
+bool FGSTextPrefetch::FindVoiceText(FNodeRef Node, const FTextResolutionParams& Parms, FString& OutText) const
+{
+	const FPrefetchedText* Text = FindText(Node, true);
+	if (!Text || Text->LocalizationIdx != Node.GetVoiceTextLocalizationIdx() || !SameParms(Text->Parms, Parms))
+	{
+		return false;
+	}
+	OutText = Text->Text;
+	return true;
+}
+
+bool FGSTextPrefetch::FindUIResponseText(FNodeRef Node, const FTextResolutionParams& Parms, FString& OutText) const
+{
+	const FPrefetchedText* Text = FindText(Node, false);
+	if (!Text || Text->LocalizationIdx != Node.GetUIResponseTextLocalizationIdx() || !SameParms(Text->Parms, Parms))
+	{
+		return false;
+	}
+	OutText = Text->Text;
+	return true;
+}
+
+void FGSTextPrefetch::Wait()
+{
+	if (BatchTask.IsValid())
+	{
+		BatchTask.Wait();
+	}
+	for (TFuture<void>& Task : RetiredTasks)
+	{
+		Task.Wait();
+	}
+	RetiredTasks.Reset();
+}
+
+void FGSTextPrefetch::Reset()
+{
+	Retire();
+}
+
+void FGSTextPrefetch::Retire()
+{
+	RetiredTasks.RemoveAll([](const TFuture<void>& Task) { return Task.IsReady(); });
+	if (BatchTask.IsValid() && !BatchTask.IsReady())
+	{
+		RetiredTasks.Add(MoveTemp(BatchTask));
+	}
+	BatchTask = TFuture<void>();
+	Batch.Reset();
+}
+
+const FGSTextPrefetch::FPrefetchedText* FGSTextPrefetch::FindText(FNodeRef Node, bool bVoice) const
+{
+	if (!Batch || !BatchTask.IsReady())
+	{
+		return nullptr;
+	}
+
+	for (const FLine& Line : Batch->Lines)
+	{
+		if (Line.NodeIndex == Node.Index)
+		{
+			const FPrefetchedText& Text = bVoice ? Line.Voice : Line.UIResponse;
+			// Empty text may be a missing translation - resolve it on demand to walk the fallbacks
+			return Text.bResolved && !Text.Text.IsEmpty() ? &Text : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+bool FGSTextPrefetch::SameParms(const FTextResolutionParams& A, const FTextResolutionParams& B)
+{
+	return FTextResolutionParams::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Refs.h"
+#include "GameScriptRunner.h"
+#include "TextResolutionParams.h"
+#include "Async/Future.h"
+
+namespace GameScript { struct Localization; struct Snapshot; }
+class IGameScriptNativeListener;
+
+/**
+ * Look-ahead text resolution for one runner context (UGameScriptSettings::LookAheadDepth).
+ *
+ * On node enter, Prefetch() walks the likely next nodes - targets of unconditional edges and of
+ * the highest-priority edge group - LookAheadDepth levels deep. Resolution params are gathered
+ * from the listener on the game thread (OnSpeechParams / OnDecisionParams) for nodes new to the
+ * look-ahead only, then voice and UI response texts are resolved on a worker. The runner takes a
+ * line only once the batch has finished and the listener still returns the same params; anything
+ * else resolves on demand.
+ *
+ * Only the current locale is prefetched; lines missing a translation (fallback chain) resolve
+ * on demand. Tasks read snapshot memory in place, so the runner waits for them whenever the
+ * database releases it (UGameScriptDatabase::OnSnapshotMemoryReleasing).
+ */
+class FGSTextPrefetch
+{
+public:
+	~FGSTextPrefetch() { Wait(); }
+
+	/**
+	 * Start resolving the lines after From. Lines of the previous batch keep their params, and
+	 * their text once that batch has finished.
+	 * @param NativeListener - Listener's native interface; asked for params instead of Listener when set
+	 * @param Depth - Edge levels to walk; 0 only retires the current batch
+	 */
+	void Prefetch(UGameScriptRunner* Runner, UObject* Listener, IGameScriptNativeListener* NativeListener, FNodeRef From, int32 Depth);
+
+	/** Get a node's prefetched voice text. @return False if not ready or resolved with other params */
+	bool FindVoiceText(FNodeRef Node, const FTextResolutionParams& Parms, FString& OutText) const;
+
+	/** Get a node's prefetched UI response text. @return False if not ready or resolved with other params */
+	bool FindUIResponseText(FNodeRef Node, const FTextResolutionParams& Parms, FString& OutText) const;
+
+	/** Block until no task reads snapshot memory. */
+	void Wait();
+
+	/** Drop all lines (in-flight tasks finish in the background). */
+	void Reset();
+
+private:
+	struct FPrefetchedText
+	{
+		int32 LocalizationIdx = -1;
+		const GameScript::Localization* Localization = nullptr;
+		FTextResolutionParams Parms;
+		FString Text;
+		bool bResolved = false;
+	};
+
+	struct FLine
+	{
+		int32 NodeIndex = -1;
+		FPrefetchedText Voice;
+		FPrefetchedText UIResponse;
+	};
+
+	// Shared with the task; the game thread reads Lines only once BatchTask is ready
+	struct FBatch
+	{
+		const GameScript::Snapshot* Snapshot = nullptr;
+		FGSLocaleFormat Format;
+		TArray<FLine> Lines;
+	};
+
+	// Upper bound on lines per batch (branchy graphs widen quickly)
+	static constexpr int32 MaxLines = 32;
+
+	TSharedPtr<FBatch, ESPMode::ThreadSafe> Batch;
+	TFuture<void> BatchTask;
+	TArray<TFuture<void>> RetiredTasks;
+
+	void Retire();
+	const FPrefetchedText* FindText(FNodeRef Node, bool bVoice) const;
+	static bool SameParms(const FTextResolutionParams& A, const FTextResolutionParams& B);
+};
@@ -0,0 +1,355 @@
+#include "TextResolver.h"
+#include "CldrPluralRules.h"
+#include "VariantResolver.h"
+#include "Iso4217.h"
+#include "Generated/snapshot_generated.h"
+#include "Internationalization/Internationalization.h"
+#include "Internationalization/Culture.h"
+
+FGSLocaleFormat FGSLocaleFormat::Make(const FString& LocaleName)
+{
+	FGSLocaleFormat Format;
+	Format.LocaleName = LocaleName;
+
+	// Normalize underscore to hyphen for ICU
+	if (!Format.LocaleName.IsEmpty())
+	{
+		Format.Culture = FInternationalization::Get().GetCulture(Format.LocaleName.Replace(TEXT("_"), TEXT("-")));
+	}
+	if (!Format.Culture.IsValid())
+	{
+		Format.Culture = FInternationalization::Get().GetDefaultCulture();
+	}
+
+	Format.CardinalRuleIdx = FCldrPluralRules::LookupCardinalRule(Format.LocaleName);
+	Format.OrdinalRuleIdx = FCldrPluralRules::LookupOrdinalRule(Format.LocaleName);
+	return Format;
+}
+
+FString FGSTextResolver::ResolveText(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale) const
+{
+	static thread_local FString Scratch;
+	return ResolveText(LocalizationIdx, Parms, Locale, Scratch);
+}
+
+FString FGSTextResolver::ResolveText(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale, FString& Scratch) const
+{
+	const FLocaleText* Requested = FindLocale(Locale.IsValid() ? Locale.Index : CurrentLocaleIndex);
+	if (LocalizationIdx < 0 || !Requested)
+	{
+		return FString();
+	}
+
+	auto ResolveIn = [this, LocalizationIdx, &Parms, &Scratch](const FLocaleText& LocaleText)
+	{
+		const GameScript::Localization* Loc = GetLocalization(LocaleText, LocalizationIdx);
+		return Loc ? ResolveLocalization(Loc, Structure, Parms, LocaleText.Format, Scratch) : FString();
+	};
+
+	FString Text = ResolveIn(*Requested);
+	if (!Text.IsEmpty())
+	{
+		return Text;
+	}
+
+	// Missing translation: walk the fallback chain captured at creation
+	for (int32 FallbackIndex : Requested->FallbackChain)
+	{
+		if (const FLocaleText* Fallback = FindLocale(FallbackIndex))
+		{
+			Text = ResolveIn(*Fallback);
+			if (!Text.IsEmpty())
+			{
+				break;
+			}
+		}
+	}
+	return Text;
+}
+
+const FGSTextResolver::FLocaleText* FGSTextResolver::FindLocale(int32 LocaleIndex) const
+{
+	for (const FLocaleText& Locale : Locales)
+	{
+		if (Locale.LocaleIndex == LocaleIndex)
+		{
+			return &Locale;
+		}
+	}
+	return nullptr;
+}
+
+const GameScript::Localization* FGSTextResolver::GetLocalization(const FLocaleText& Locale, int32 LocalizationIdx) const
+{
+	if (!Structure || !Structure->localizations() || LocalizationIdx >= static_cast<int32>(Structure->localizations()->size()))
+	{
+		return nullptr;
+	}
+	if (Locale.Streamed.Num() > 0)
+	{
+		return Locale.Streamed[LocalizationIdx];
+	}
+	return Locale.Text ? Locale.Text->localizations()->Get(LocalizationIdx) : nullptr;
+}
+
+FString FGSTextResolver::ResolveLocalization(
+	const GameScript::Localization* Loc,
+	const GameScript::Snapshot* Snap,
+	const FTextResolutionParams& Parms,
+	const FGSLocaleFormat& Format,
+	FString& Scratch)
+{
+	// 1. Resolve gender
+	EGSGenderCategory Gender = ResolveGender(Loc, Parms, Snap);
+
+	// 2. Resolve plural category (cardinal or ordinal based on PluralArg.Type)
+	EGSPluralCategory Plural = EGSPluralCategory::Other;
+	if (Parms.bHasPlural)
+	{
+		if (Parms.Plural.Type == EGSPluralType::Ordinal)
+		{
+			// Ordinal rules are integer-only; clamp int64 to int32
+			int32 OrdinalN = static_cast<int32>(FMath::Clamp(Parms.Plural.Value, (int64)INT32_MIN, (int64)INT32_MAX));
+			Plural = FCldrPluralRules::ApplyOrdinalRule(Format.OrdinalRuleIdx, OrdinalN);
+		}
+		else
+		{
+			Plural = FCldrPluralRules::ApplyRule(Format.CardinalRuleIdx, Parms.Plural.Value, Parms.Plural.Precision);
+		}
+	}
+
+	// 3. Select variant
+	FString Text = FVariantResolver::Resolve(Loc, Gender, Plural);
+	if (Text.IsEmpty())
+	{
+		return FString();
+	}
+
+	// 4. Template substitution — only when is_templated is set and there are args
+	bool bHasPlural = Parms.bHasPlural;
+	bool bHasArgs = Parms.Args.Num() > 0;
+	if (Loc->is_templated() && (bHasPlural || bHasArgs))
+	{
+		ApplyTemplate(Text, Parms, Format, Scratch);
+		Text = Scratch;
+	}
+
+	return Text;
+}
+
+EGSGenderCategory FGSTextResolver::ResolveGender(
+	const GameScript::Localization* Loc,
+	const FTextResolutionParams& Parms,
+	const GameScript::Snapshot* Snapshot)
+{
+	// Caller-supplied override always wins
+	if (Parms.bHasGenderOverride)
+	{
+		return Parms.GenderOverride;
+	}
+
+	// Derive from subject actor's grammatical gender (subject_actor takes precedence)
+	int32 ActorIdx = Loc->subject_actor_idx();
+	if (ActorIdx >= 0)
+	{
+		GameScript::GrammaticalGender GG = Snapshot->actors()->Get(ActorIdx)->grammatical_gender();
+		switch (GG)
+		{
+			case GameScript::GrammaticalGender_Masculine: return EGSGenderCategory::Masculine;
+			case GameScript::GrammaticalGender_Feminine:  return EGSGenderCategory::Feminine;
+			case GameScript::GrammaticalGender_Neuter:    return EGSGenderCategory::Neuter;
+			default:                                      return EGSGenderCategory::Other; // Other + Dynamic
+		}
+	}
+
+	// Fall back to direct gender override (GenderCategory::Other when unset)
+	return static_cast<EGSGenderCategory>(Loc->subject_gender());
+}
+
+void FGSTextResolver::ApplyTemplate(const FString& Text, const FTextResolutionParams& Parms, const FGSLocaleFormat& Format, FString& OutText)
+{
+	OutText.Reset();
+
+	const TCHAR* Data = *Text;
+	int32 Len = Text.Len();
+	int32 i = 0;
+
+	while (i < Len)
+	{
+		TCHAR C = Data[i];
+
+		if (C == TEXT('{'))
+		{
+			// Escaped brace: {{ -> '{'
+			if (i + 1 < Len && Data[i + 1] == TEXT('{'))
+			{
+				OutText.AppendChar(TEXT('{'));
+				i += 2;
+				continue;
+			}
+
+			// Scan for matching '}'
+			int32 Start = i + 1;
+			int32 End = Start;
+			while (End < Len && Data[End] != TEXT('}'))
+			{
+				End++;
+			}
+
+			if (End >= Len)
+			{
+				// Malformed — no closing brace; emit rest of string literally
+				OutText.Append(Data + i, Len - i);
+				break;
+			}
+
+			FString Placeholder(End - Start, Data + Start);
+
+			// Try PluralArg first (formatted as locale-aware number)
+			bool bResolved = false;
+			if (Parms.bHasPlural && Parms.Plural.Name.Equals(Placeholder, ESearchCase::CaseSensitive))
+			{
+				if (Parms.Plural.Precision > 0)
+				{
+					// Decimal: format with Precision decimal places
+					double DisplayValue = static_cast<double>(Parms.Plural.Value) / Pow10(Parms.Plural.Precision);
+					FNumberFormattingOptions Opts;
+					Opts.SetMaximumFractionalDigits(Parms.Plural.Precision);
+					Opts.SetMinimumFractionalDigits(Parms.Plural.Precision);
+					OutText.Append(FText::AsNumber(DisplayValue, &Opts, Format.Culture).ToString());
+				}
+				else
+				{
+					// Integer: grouped integer formatting
+					FNumberFormattingOptions Opts;
+					Opts.SetMaximumFractionalDigits(0);
+					Opts.SetMinimumFractionalDigits(0);
+					OutText.Append(FText::AsNumber(Parms.Plural.Value, &Opts, Format.Culture).ToString());
+				}
+				bResolved = true;
+			}
+
+			// Try typed Args
+			if (!bResolved)
+			{
+				for (int32 A = 0; A < Parms.Args.Num(); A++)
+				{
+					if (Parms.Args[A].Name.Equals(Placeholder, ESearchCase::CaseSensitive))
+					{
+						FString Formatted;
+						FormatArg(Parms.Args[A], Format, Formatted);
+						OutText.Append(Formatted);
+						bResolved = true;
+						break;
+					}
+				}
+			}
+
+			// Unknown placeholder — pass through unchanged
+			if (!bResolved)
+			{
+				OutText.AppendChar(TEXT('{'));
+				OutText.Append(Placeholder);
+				OutText.AppendChar(TEXT('}'));
+			}
+
+			i = End + 1; // skip past '}'
+		}
+		else if (C == TEXT('}'))
+		{
+			// Escaped brace: }} -> '}'
+			if (i + 1 < Len && Data[i + 1] == TEXT('}'))
+			{
+				OutText.AppendChar(TEXT('}'));
+				i += 2;
+			}
+			else
+			{
+				// Lone '}' — emit literally (lenient)
+				OutText.AppendChar(TEXT('}'));
+				i++;
+			}
+		}
+		else
+		{
+			OutText.AppendChar(C);
+			i++;
+		}
+	}
+}
+
+void FGSTextResolver::FormatArg(const FGSArg& Arg, const FGSLocaleFormat& Format, FString& OutResult)
+{
+	switch (Arg.Type)
+	{
+		case EGSArgType::String:
+		{
+			OutResult = Arg.StringValue;
+			break;
+		}
+
+		case EGSArgType::Int:
+		{
+			FNumberFormattingOptions Opts;
+			Opts.SetMaximumFractionalDigits(0);
+			Opts.SetMinimumFractionalDigits(0);
+			OutResult = FText::AsNumber(Arg.NumericValue, &Opts, Format.Culture).ToString();
+			break;
+		}
+
+		case EGSArgType::Decimal:
+		{
+			double Value = static_cast<double>(Arg.NumericValue) / Pow10(Arg.Precision);
+			FNumberFormattingOptions Opts;
+			Opts.SetMaximumFractionalDigits(Arg.Precision);
+			Opts.SetMinimumFractionalDigits(Arg.Precision);
+			OutResult = FText::AsNumber(Value, &Opts, Format.Culture).ToString();
+			break;
+		}
+
+		case EGSArgType::Percent:
+		{
+			// Value is percentage x 10^precision (e.g., 155 with precision 1 = 15.5%)
+			// Divide by 10^precision to get the percentage, then by 100 for fractional form
+			double Pct = static_cast<double>(Arg.NumericValue) / Pow10(Arg.Precision) / 100.0;
+			FNumberFormattingOptions Opts;
+			Opts.SetMaximumFractionalDigits(Arg.Precision);
+			Opts.SetMinimumFractionalDigits(Arg.Precision);
+			OutResult = FText::AsPercent(Pct, &Opts, Format.Culture).ToString();
+			break;
+		}
+
+		case EGSArgType::Currency:
+		{
+			int32 Decimals = FIso4217::GetMinorUnitDigits(Arg.CurrencyCode);
+			double Value = static_cast<double>(Arg.NumericValue) / Pow10(Decimals);
+			FString Symbol = FIso4217::GetSymbol(Arg.CurrencyCode, Format.LocaleName);
+			FNumberFormattingOptions Opts;
+			Opts.SetMaximumFractionalDigits(Decimals);
+			Opts.SetMinimumFractionalDigits(Decimals);
+			OutResult = FText::AsCurrencyBase(Arg.NumericValue, Arg.CurrencyCode, Format.Culture).ToString();
+			break;
+		}
+
+		case EGSArgType::RawInt:
+		{
+			OutResult = FString::Printf(TEXT("%lld"), Arg.NumericValue);
+			break;
+		}
+	}
+}
+
+double FGSTextResolver::Pow10(int32 Exponent)
+{
+	switch (Exponent)
+	{
+		case 0: return 1.0;
+		case 1: return 10.0;
+		case 2: return 100.0;
+		case 3: return 1000.0;
+		case 4: return 10000.0;
+		case 5: return 100000.0;
+		case 6: return 1000000.0;
+		default: return FMath::Pow(10.0, static_cast<double>(Exponent));
+	}
+}
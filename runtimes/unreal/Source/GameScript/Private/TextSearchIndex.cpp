@@ -0,0 +1,251 @@
+#include "TextSearchIndex.h"
+#include "SnapshotVersion.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+#include "Generated/snapshot_generated.h"
+
+namespace
+{
+	constexpr uint32 WordBreak = ' ';
+
+	// Base letters for U+00C0..U+017F (Latin-1 Supplement letters, Latin Extended-A); ' ' is a word break
+	const ANSICHAR LatinFold[] =
+		"aaaaaaaceeeeiiiidnooooo ouuuuyts"
+		"aaaaaaaceeeeiiiidnooooo ouuuuyty"
+		"aaaaaaccccccccddddeeeeeeeeeegggggggghhhhiiiiiiiiiiiijjkkklllllll"
+		"lllnnnnnnnnnoooooooorrrrrrssssssssttttttuuuuuuuuuuuuwwyyyzzzzzzs";
+	static_assert(sizeof(LatinFold) == 0x180 - 0xC0 + 1, "One base letter per code point");
+
+	/** Case-fold a code point and strip Latin diacritics. @return 0 to drop it, WordBreak for separators */
+	uint32 FoldCodePoint(uint32 C)
+	{
+		if (C < 0x80)
+		{
+			if (C >= 'A' && C <= 'Z')
+			{
+				return C + ('a' - 'A');
+			}
+			return (C >= 'a' && C <= 'z') || (C >= '0' && C <= '9') ? C : WordBreak;
+		}
+		if (C >= 0x300 && C <= 0x36F)
+		{
+			return 0;   // Combining diacritical marks
+		}
+		if (C >= 0xC0 && C <= 0x17F)
+		{
+			return static_cast<uint32>(LatinFold[C - 0xC0]);
+		}
+		if (C < 0xC0 || (C >= 0x2000 && C <= 0x206F) || (C >= 0x3000 && C <= 0x303F))
+		{
+			return WordBreak;   // Latin-1 symbols, general and CJK punctuation
+		}
+		if (C <= 0xFFFF)
+		{
+			const TCHAR Char = static_cast<TCHAR>(C);
+			return FChar::IsWhitespace(Char) ? WordBreak : static_cast<uint32>(FChar::ToLower(Char));
+		}
+		return C;
+	}
+
+	uint32 DecodeUtf8(const uint8*& It, const uint8* End)
+	{
+		const uint32 Lead = *It++;
+		if (Lead < 0x80)
+		{
+			return Lead;
+		}
+		if (Lead < 0xC0)
+		{
+			return 0xFFFD;   // Stray continuation byte
+		}
+
+		int32 Extra = Lead >= 0xF0 ? 3 : Lead >= 0xE0 ? 2 : 1;
+		uint32 C = Lead & (0x3F >> Extra);
+		for (; Extra > 0 && It < End && (*It & 0xC0) == 0x80; --Extra)
+		{
+			C = (C << 6) | (*It++ & 0x3F);
+		}
+		return Extra == 0 ? C : 0xFFFD;
+	}
+
+	// Three 21-bit code points; 0 pads word boundaries
+	uint64 PackTrigram(uint32 A, uint32 B, uint32 C)
+	{
+		return (static_cast<uint64>(A) << 42) | (static_cast<uint64>(B) << 21) | C;
+	}
+
+	void SortUnique(TArray<uint64>& Values)
+	{
+		Values.Sort();
+		Values.SetNum(Algo::Unique(Values));
+	}
+}
+
+void FGSTextSearchIndex::ExtractTrigrams(const ANSICHAR* Utf8, int32 Length, bool bWordEnds, TArray<uint64>& OutTrigrams)
+{
+	const uint8* It = reinterpret_cast<const uint8*>(Utf8);
+	const uint8* End = It + Length;
+	uint32 Window[2] = { 0, 0 };
+	bool bInWord = false;
+
+	auto Push = [&Window, &OutTrigrams](uint32 C)
+	{
+		OutTrigrams.Add(PackTrigram(Window[0], Window[1], C));
+		Window[0] = Window[1];
+		Window[1] = C;
+	};
+
+	while (It < End)
+	{
+		const uint32 Folded = FoldCodePoint(DecodeUtf8(It, End));
+		if (Folded == 0)
+		{
+			continue;
+		}
+		if (Folded == WordBreak)
+		{
+			if (bInWord && bWordEnds)
+			{
+				Push(0);
+			}
+			bInWord = false;
+			continue;
+		}
+		if (!bInWord)
+		{
+			Window[0] = Window[1] = 0;
+			bInWord = true;
+		}
+		Push(Folded);
+	}
+	if (bInWord && bWordEnds)
+	{
+		Push(0);
+	}
+}
+
+FGSTextSearchIndex::FGSTextSearchIndex(const FGSSnapshotVersion& InVersion)
+	: Version(InVersion.GetVersion())
+{
+	const GameScript::Snapshot* Snapshot = InVersion.GetSnapshot();
+	const int32 Count = Snapshot && Snapshot->localizations() ? static_cast<int32>(Snapshot->localizations()->size()) : 0;
+	EntryTrigramCounts.SetNumZeroed(Count);
+
+	// Localizations are visited in index order, so every posting list comes out sorted
+	TMap<uint64, TArray<int32>> Lists;
+	TArray<uint64> Entry;
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const GameScript::Localization* Loc = InVersion.GetLocalizationText(i);
+		const auto* Variants = Loc ? Loc->variants() : nullptr;
+		if (!Variants)
+		{
+			continue;
+		}
+
+		Entry.Reset();
+		for (const GameScript::TextVariant* Variant : *Variants)
+		{
+			if (Variant->text())
+			{
+				ExtractTrigrams(Variant->text()->c_str(), Variant->text()->size(), true, Entry);
+			}
+		}
+		SortUnique(Entry);
+
+		EntryTrigramCounts[i] = Entry.Num();
+		for (uint64 Trigram : Entry)
+		{
+			Lists.FindOrAdd(Trigram).Add(i);
+		}
+	}
+
+	// Flatten into a sorted trigram table with one contiguous posting array
+	Lists.KeySort(TLess<uint64>());
+	int32 PostingCount = 0;
+	for (const TPair<uint64, TArray<int32>>& List : Lists)
+	{
+		PostingCount += List.Value.Num();
+	}
+
+	Trigrams.Reserve(Lists.Num());
+	PostingOffsets.Reserve(Lists.Num() + 1);
+	Postings.Reserve(PostingCount);
+	for (const TPair<uint64, TArray<int32>>& List : Lists)
+	{
+		Trigrams.Add(List.Key);
+		PostingOffsets.Add(Postings.Num());
+		Postings.Append(List.Value);
+	}
+	PostingOffsets.Add(Postings.Num());
+}
+
+void FGSTextSearchIndex::Search(const FString& Query, TArray<FGSTextMatch>& OutMatches, int32 MaxResults, float MinScore) const
+{
+	OutMatches.Reset();
+
+	const FTCHARToUTF8 Utf8(*Query);
+	TArray<uint64> QueryTrigrams;
+	ExtractTrigrams(Utf8.Get(), Utf8.Length(), false, QueryTrigrams);
+	SortUnique(QueryTrigrams);
+	if (QueryTrigrams.Num() == 0 || MaxResults <= 0)
+	{
+		return;
+	}
+
+	const int32 QueryCount = QueryTrigrams.Num();
+	const int32 Required = FMath::Clamp(FMath::CeilToInt(MinScore * QueryCount), 1, QueryCount);
+
+	// Count each entry's hits across the query's posting lists
+	TArray<int32> Hits;
+	Hits.SetNumZeroed(Num());
+	TArray<int32> Candidates;
+	int32 Missing = 0;
+	for (uint64 Trigram : QueryTrigrams)
+	{
+		const int32 Found = Algo::BinarySearch(Trigrams, Trigram);
+		if (Found == INDEX_NONE)
+		{
+			if (++Missing > QueryCount - Required)
+			{
+				return;
+			}
+			continue;
+		}
+
+		for (int32 p = PostingOffsets[Found]; p < PostingOffsets[Found + 1]; ++p)
+		{
+			const int32 EntryIndex = Postings[p];
+			if (Hits[EntryIndex]++ == 0)
+			{
+				Candidates.Add(EntryIndex);
+			}
+		}
+	}
+
+	for (int32 EntryIndex : Candidates)
+	{
+		if (Hits[EntryIndex] >= Required)
+		{
+			FGSTextMatch& Match = OutMatches.AddDefaulted_GetRef();
+			Match.LocalizationIndex = EntryIndex;
+			Match.Score = static_cast<float>(Hits[EntryIndex]) / QueryCount;
+		}
+	}
+
+	// Best score first, then shorter entries (the query covers more of them), then index order
+	OutMatches.Sort([this](const FGSTextMatch& A, const FGSTextMatch& B)
+	{
+		if (A.Score != B.Score)
+		{
+			return A.Score > B.Score;
+		}
+		const int32 LengthA = EntryTrigramCounts[A.LocalizationIndex];
+		const int32 LengthB = EntryTrigramCounts[B.LocalizationIndex];
+		return LengthA != LengthB ? LengthA < LengthB : A.LocalizationIndex < B.LocalizationIndex;
+	});
+	if (OutMatches.Num() > MaxResults)
+	{
+		OutMatches.SetNum(MaxResults);
+	}
+}
@@ -7,26 +7,26 @@
  * Used to query/stop conversations from GameScriptRunner.
  *
  * Contains:
- * - Context ID (unique identifier for the RunnerContext)
- * - Sequence number (prevents stale access after context reuse)
+ * - Slot (index of the RunnerContext in the runner's slot map)
+ * - Generation (the slot's generation when the conversation started; bumped on release)
  *
- * This ID-based design (matching Unity) ensures handles remain valid even when
- * other conversations end, unlike index-based approaches that break when arrays shift.
+ * Validating a handle is one array index and compare: a slot keeps its context for the runner's
+ * lifetime, and releasing it bumps the generation, so stale handles never match a reused slot.
  */
 struct GAMESCRIPT_API FActiveConversation
 {
-	int32 ContextId = -1;
-	int32 Sequence = 0;
+	int32 Slot = -1;
+	int32 Generation = 0;
 
 	constexpr FActiveConversation() = default;
-	constexpr FActiveConversation(int32 InContextId, int32 InSequence)
-		: ContextId(InContextId), Sequence(InSequence) {}
+	constexpr FActiveConversation(int32 InSlot, int32 InGeneration)
+		: Slot(InSlot), Generation(InGeneration) {}
 
-	constexpr bool IsValid() const { return ContextId >= 0; }
+	constexpr bool IsValid() const { return Slot >= 0; }
 
 	constexpr bool operator==(const FActiveConversation& Other) const
 	{
-		return ContextId == Other.ContextId && Sequence == Other.Sequence;
+		return Slot == Other.Slot && Generation == Other.Generation;
 	}
 
 	constexpr bool operator!=(const FActiveConversation& Other) const
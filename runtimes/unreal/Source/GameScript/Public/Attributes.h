@@ -22,8 +22,10 @@ struct GAMESCRIPT_API FNodeConditionRegistration
 {
 	int32 NodeId;
 	ConditionDelegate Function;
+	bool bVolatile;
+	bool bThreadSafe;
 
-	FNodeConditionRegistration(int32 InNodeId, ConditionDelegate InFunction);
+	FNodeConditionRegistration(int32 InNodeId, ConditionDelegate InFunction, bool bInVolatile = false, bool bInThreadSafe = false);
 };
 
 struct GAMESCRIPT_API FNodeActionRegistration
@@ -79,17 +81,10 @@ extern GAMESCRIPT_API TArray<FNodeActionRegistration*> GActionRegistrations;
  * NODE_CONDITION(789)
  * bool HasRequiredGold(const IDialogueContext* Context)
  * {
- *     // Get custom property "required_gold" from node
+ *     // Get custom property "required_gold" from node (static FName: no per-call string work)
+ *     static const FName RequiredGoldName(TEXT("required_gold"));
  *     int32 RequiredGold = 0;
- *     for (int32 i = 0; i < Context->GetPropertyCount(); ++i)
- *     {
- *         FNodePropertyRef Prop = Context->GetProperty(i);
- *         if (Prop.GetKey() == "required_gold")
- *         {
- *             RequiredGold = FCString::Atoi(*Prop.GetValue());
- *             break;
- *         }
- *     }
+ *     Context->FindProperty(RequiredGoldName).TryGetInt(RequiredGold);
  *
  *     AMyGameState* GameState = GetGameState();
  *     return GameState->PlayerGold >= RequiredGold;
@@ -102,6 +97,55 @@ extern GAMESCRIPT_API TArray<FNodeActionRegistration*> GActionRegistrations;
 		NodeId, &__NodeCondition_##NodeId##_Impl); \
 	static bool __NodeCondition_##NodeId##_Impl(const IDialogueContext* Context)
 
+/**
+ * Macro: NODE_CONDITION_VOLATILE(NodeId)
+ *
+ * Same as NODE_CONDITION, for conditions whose result can change while the source node's
+ * speech is playing (e.g., state modified by a timer or another system).
+ * With UGameScriptSettings::bSpeculativeChoices enabled, choices are evaluated while the
+ * node's speech plays; volatile conditions are evaluated again once it finishes. Nodes with a
+ * latent action in flight are never evaluated early.
+ *
+ * \code
+ * NODE_CONDITION_VOLATILE(321)
+ * bool DoorIsOpen(const IDialogueContext* Context)
+ * {
+ *     return GetDoor()->IsOpen();  // Opened by a timer while the line plays
+ * }
+ * \endcode
+ */
+#define NODE_CONDITION_VOLATILE(NodeId) \
+	static bool __NodeCondition_##NodeId##_Impl(const IDialogueContext* Context); \
+	static FNodeConditionRegistration __NodeCondition_##NodeId##_Registration( \
+		NodeId, &__NodeCondition_##NodeId##_Impl, true); \
+	static bool __NodeCondition_##NodeId##_Impl(const IDialogueContext* Context)
+
+/**
+ * Macro: NODE_CONDITION_THREADSAFE(NodeId)
+ *
+ * Same as NODE_CONDITION, for conditions that may run on a worker thread. With
+ * UGameScriptSettings::bParallelConditions enabled, the thread-safe conditions of a node with
+ * many outgoing edges are evaluated in parallel (the game thread waits for them).
+ *
+ * The function must only read state that is safe to read concurrently: no UObject creation,
+ * no Blueprint calls, no writes. The context is a per-task view of the target node; its
+ * IDialogueContext accessors are safe to call. Conditions registered with the plain macros can
+ * be marked at runtime with UGameScriptRunner::SetConditionThreadSafe().
+ *
+ * \code
+ * NODE_CONDITION_THREADSAFE(654)
+ * bool KnowsRumor(const IDialogueContext* Context)
+ * {
+ *     return GRumorFlags.IsKnown(Context->GetNodeId());  // Immutable while dialogue evaluates
+ * }
+ * \endcode
+ */
+#define NODE_CONDITION_THREADSAFE(NodeId) \
+	static bool __NodeCondition_##NodeId##_Impl(const IDialogueContext* Context); \
+	static FNodeConditionRegistration __NodeCondition_##NodeId##_Registration( \
+		NodeId, &__NodeCondition_##NodeId##_Impl, false, true); \
+	static bool __NodeCondition_##NodeId##_Impl(const IDialogueContext* Context)
+
 /**
  * Macro: NODE_ACTION(NodeId)
  *
@@ -172,16 +216,9 @@ extern GAMESCRIPT_API TArray<FNodeActionRegistration*> GActionRegistrations;
  * UGameplayTask* AwardDynamicReward(const IDialogueContext* Context)
  * {
  *     // Get reward amount from node property
+ *     static const FName GoldAmountName(TEXT("gold_amount"));
  *     int32 GoldReward = 50;  // Default
- *     for (int32 i = 0; i < Context->GetPropertyCount(); ++i)
- *     {
- *         FNodePropertyRef Prop = Context->GetProperty(i);
- *         if (Prop.GetKey() == "gold_amount")
- *         {
- *             GoldReward = FCString::Atoi(*Prop.GetValue());
- *             break;
- *         }
- *     }
+ *     Context->FindProperty(GoldAmountName).TryGetInt(GoldReward);
  *
  *     AMyGameState* GameState = GetGameState();
  *     GameState->PlayerGold += GoldReward;
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Kinds of events captured by FGSConversationRecorder.
+ */
+enum class EGSRecordedEvent : uint8
+{
+	/** Conversation started. NodeId = start node (-1 = root), Value = conversation ID. */
+	Start = 0,
+
+	/** Started at a saved node. Follows Start. NodeId = resume node, Value = 1 if resumed at its decision. */
+	Resume = 1,
+
+	/** State machine transition. NodeId = current node (-1 = none), Value = runner context state ordinal. */
+	State = 2,
+
+	/** Edge condition evaluated. NodeId = edge target node, Value = 1 if it passed. */
+	Condition = 3,
+
+	/** Choice taken. NodeId = chosen node, Value = index into the offered choices (-1 = auto-decision). */
+	Choice = 4
+};
+
+/**
+ * One recorded event (24 bytes). Events of one conversation share ContextId; context IDs are
+ * reused by pooled contexts, so a conversation runs from its Start to the next Start with that ID.
+ */
+struct FGSRecordedEvent
+{
+	uint64 TimestampNs = 0;      // FPlatformTime clock, nanoseconds
+	int32 ContextId = -1;
+	int32 NodeId = -1;
+	int32 Value = 0;
+	EGSRecordedEvent Type = EGSRecordedEvent::State;
+
+	friend FArchive& operator<<(FArchive& Ar, FGSRecordedEvent& Event)
+	{
+		uint8 Type = static_cast<uint8>(Event.Type);
+		Ar << Event.TimestampNs << Event.ContextId << Event.NodeId << Event.Value << Type;
+		Event.Type = static_cast<EGSRecordedEvent>(Type);
+		return Ar;
+	}
+};
+
+/**
+ * Fixed-size ring buffer of runner events (transitions, condition results, choices).
+ *
+ * Cheap enough to leave on in shipping builds: recording is a clock read and a 24-byte store
+ * into storage allocated once by SetCapacity(). When full, the oldest events are overwritten.
+ * Game thread only. Recordings can be written to disk and replayed with
+ * UGameScriptRunner::ReplayConversation().
+ */
+class GAMESCRIPT_API FGSConversationRecorder
+{
+public:
+	FGSConversationRecorder();
+
+	/**
+	 * Allocate room for the most recent events (rounded up to a power of two). Clears the recording.
+	 * @param Capacity - Number of events kept; 0 disables recording
+	 */
+	void SetCapacity(int32 Capacity);
+
+	int32 GetCapacity() const { return Ring.Num(); }
+
+	bool IsEnabled() const { return Ring.Num() > 0; }
+
+	/** Append an event, overwriting the oldest when full. */
+	FORCEINLINE void Record(EGSRecordedEvent Type, int32 ContextId, int32 NodeId, int32 Value)
+	{
+		if (Ring.Num() == 0)
+		{
+			return;
+		}
+
+		FGSRecordedEvent& Event = Ring[static_cast<int32>(Head & Mask)];
+		Event.TimestampNs = static_cast<uint64>(FPlatformTime::Cycles64() * NanosecondsPerCycle);
+		Event.ContextId = ContextId;
+		Event.NodeId = NodeId;
+		Event.Value = Value;
+		Event.Type = Type;
+		++Head;
+	}
+
+	/** Discard recorded events (keeps the allocation). */
+	void Reset() { Head = 0; }
+
+	/** Copy the recorded events out, oldest first. */
+	void GetEvents(TArray<FGSRecordedEvent>& OutEvents) const;
+
+	/** Write the recorded events to a file ('GSR1' header + events). */
+	bool SaveToFile(const FString& Path) const;
+
+	/** Read events written by SaveToFile(). */
+	static bool LoadFromFile(const FString& Path, TArray<FGSRecordedEvent>& OutEvents);
+
+	/**
+	 * Find the most recent Start event of a context.
+	 * @return Index into Events, or INDEX_NONE
+	 */
+	static int32 FindLastStart(TConstArrayView<FGSRecordedEvent> Events, int32 ContextId);
+
+private:
+	TArray<FGSRecordedEvent> Ring;
+	uint64 Head = 0;
+	uint64 Mask = 0;
+	double NanosecondsPerCycle = 0.0;
+};
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ConversationSave.generated.h"
+
+/**
+ * Where a saved conversation resumes.
+ */
+UENUM(BlueprintType)
+enum class EGSConversationResumePoint : uint8
+{
+	/** Enter the saved node (OnNodeEnter, speech and action run again). */
+	Node,
+
+	/** Re-present the saved node's decision (conditions are re-evaluated). */
+	Decision
+};
+
+/**
+ * Fixed-size record of an in-flight conversation (16 bytes serialized).
+ * Produced by UGameScriptRunner::SaveConversation(), consumed by RestoreConversation().
+ *
+ * Nothing before the saved node is recorded or replayed: restoring calls OnConversationEnter,
+ * then continues straight at the node or decision. IDs are stable across exports, so records
+ * survive snapshot updates as long as the node still exists.
+ */
+USTRUCT(BlueprintType)
+struct GAMESCRIPT_API FGSConversationSave
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadWrite, SaveGame, Category = "GameScript")
+	int32 ConversationId = -1;
+
+	UPROPERTY(BlueprintReadWrite, SaveGame, Category = "GameScript")
+	int32 NodeId = -1;
+
+	UPROPERTY(BlueprintReadWrite, SaveGame, Category = "GameScript")
+	EGSConversationResumePoint ResumePoint = EGSConversationResumePoint::Node;
+
+	/**
+	 * Hash of the valid choice node IDs when a decision was saved (0 otherwise).
+	 * A different set on restore means game state changed what the player may pick.
+	 */
+	UPROPERTY(BlueprintReadWrite, SaveGame, Category = "GameScript")
+	int32 ChoiceFingerprint = 0;
+
+	bool IsValid() const { return ConversationId >= 0 && NodeId >= 0; }
+
+	friend FArchive& operator<<(FArchive& Ar, FGSConversationSave& Save)
+	{
+		uint32 ResumePoint = static_cast<uint32>(Save.ResumePoint);
+		Ar << Save.ConversationId << Save.NodeId << ResumePoint << Save.ChoiceFingerprint;
+		Save.ResumePoint = static_cast<EGSConversationResumePoint>(ResumePoint);
+		return Ar;
+	}
+};
@@ -3,21 +3,20 @@
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
 #include "Refs.h"
+#include "GSCompletionToken.h"
 #include "GSCompletionHandle.generated.h"
 
-class URunnerContext;
-
 /**
  * Completion handle for async listener callbacks.
  * Acts as a "return address" - listener calls methods on this to signal completion.
  *
- * Pattern: Each URunnerContext owns one handle (allocated once, reused).
+ * Pattern: Handles are pooled by the runner and wrap an FGSCompletionToken.
  * Before firing listener event, context calls Initialize() to set up the handle.
  * Listener receives handle and calls NotifyReady() or SelectChoice() when done.
  *
  * Safety:
- * - TWeakObjectPtr prevents crashes if context is destroyed
- * - ContextID validation prevents stale completions
+ * - The token resolves the context through the runner (weak), so a finished runner is harmless
+ * - Slot generation and event ID validation prevent stale completions
  * - Invalidates after use to prevent double-signals
  */
 UCLASS(BlueprintType)
@@ -55,7 +54,7 @@ public:
 	 * Initialize handle for a new lifecycle event.
 	 * Called by RunnerContext before firing listener callback.
 	 */
-	void Initialize(URunnerContext* InOwner, int32 InContextID);
+	void Initialize(const FGSCompletionToken& InToken);
 
 	/**
 	 * Invalidate the handle (called after use or on cancellation).
@@ -69,6 +68,6 @@ public:
 	bool IsValid() const;
 
 private:
-	TWeakObjectPtr<URunnerContext> OwnerContext;
-	int32 ContextID = -1;
+	FGSCompletionToken Token;
+	bool bInitialized = false;
 };
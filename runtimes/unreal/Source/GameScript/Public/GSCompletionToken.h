@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "ActiveConversation.h"
+#include "Refs.h"
+
+class UGameScriptRunner;
+
+/**
+ * Completion token for native (C++) listeners - the value-type counterpart of UGSCompletionHandle.
+ *
+ * Identifies one listener event: the conversation (slot + generation) and the event ID the
+ * context is waiting on. Completing it goes straight to the runner; nothing is allocated, pooled
+ * or reported to GC. Passed to IGameScriptNativeListener events; Blueprint listeners keep
+ * receiving UGSCompletionHandle.
+ *
+ * Safety:
+ * - Safe to copy and store (in timers, callbacks, etc.); stale copies are ignored
+ * - Only the first completion for an event is accepted
+ * - May be completed from any thread (completion is forwarded to the game thread)
+ */
+struct GAMESCRIPT_API FGSCompletionToken
+{
+	FGSCompletionToken() = default;
+
+	/** Signal that async work is complete and the runner should proceed. */
+	void NotifyReady() const;
+
+	/** Select a choice and proceed to it (response to OnDecision). */
+	void SelectChoice(FNodeRef Choice) const;
+
+	/** Select a choice by index into the choices passed to OnDecision. */
+	void SelectChoiceByIndex(int32 ChoiceIndex) const;
+
+	/** Check if the event is still waiting on this token. Game thread. */
+	bool IsValid() const;
+
+private:
+	friend class FRunnerContext;
+
+	FGSCompletionToken(UGameScriptRunner* InRunner, FActiveConversation InConversation, int32 InEventId)
+		: Runner(InRunner), Conversation(InConversation), EventId(InEventId)
+	{
+	}
+
+	TWeakObjectPtr<UGameScriptRunner> Runner;
+	FActiveConversation Conversation;
+	int32 EventId = -1;
+};
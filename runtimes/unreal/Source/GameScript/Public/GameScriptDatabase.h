@@ -2,15 +2,25 @@
 
 #include "CoreMinimal.h"
 #include "UObject/Object.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
 #include "Refs.h"
+#include "SnapshotVersion.h"
+#include "PropertyQuery.h"
+#include "TextSearchIndex.h"
+#include <atomic>
 #include "GameScriptDatabase.generated.h"
 
 // Forward declaration of FlatBuffers snapshot type
 namespace GameScript
 {
 	struct Snapshot;
+	struct Localization;
 }
 
+class FGSTextResolver;
+struct FGSPropertyColumn;
+
 /**
  * Database providing access to FlatBuffers snapshot data.
  * Zero-copy access - all ref types read directly from the buffer.
@@ -21,6 +31,33 @@ namespace GameScript
  * 3. Provides entity lookups by ID or index
  * 4. Can change locale at runtime (reloads snapshot)
  *
+ * Compressed Snapshots:
+ * - Block-compressed snapshots (.gsz) are decompressed in parallel at load
+ *   into the same buffer a .gsb would occupy
+ *
+ * Split Layout:
+ * - A shared structure (.gss) plus one string table (.gst) per locale; changing locale
+ *   loads only the new string table and keeps the structure, ID maps and jump tables
+ *
+ * Resident Locales:
+ * - Additional locales' text can be kept resident alongside the current locale
+ *   (AddResidentLocale) and read via GetLocalizationText(Idx, LocaleIndex), sharing one structure
+ * - Locales in the current locale's manifest fallback chain are kept resident automatically,
+ *   so missing text resolves from them without a second database
+ *
+ * Conversation Streaming:
+ * - Chunked snapshots (.gsc) keep a text-free index resident and stream each
+ *   conversation's localized text on demand (StartConversation or PrefetchConversation)
+ * - Unpinned text blocks are evicted least-recently-used once the streaming budget is exceeded
+ *
+ * Pinned Versions:
+ * - Each load, locale change and reload publishes an immutable FGSSnapshotVersion; worker
+ *   threads pin it with PinSnapshot() and read it lock-free until they release the pin
+ *
+ * Runtime Hot Reload (non-shipping builds):
+ * - Watches the loaded snapshot and reloads it when re-exported; runners remap their
+ *   in-flight conversations to the new snapshot by node ID
+ *
  * Editor Support:
  * - EditorInstance provides lazy-loaded singleton with hot-reload
  * - Property drawers use EditorInstance for name lookups
@@ -36,10 +73,21 @@ public:
 
 	/**
 	 * Load a snapshot from disk.
-	 * @param SnapshotPath - Full path to .gsb file
+	 * Chunked snapshots (.gsc) load only their index; conversation text is streamed on demand.
+	 * Compressed snapshots (.gsz) are detected by header and decompressed before verification.
+	 * String tables (.gst) load against the shared structure.gss, which stays resident across locales.
+	 * Verification follows UGameScriptSettings::SnapshotVerification and bTrustManifestHash.
+	 * @param SnapshotPath - Full path to .gsb, .gsz, .gsc or .gst file
+	 * @param ExpectedHash - Manifest SHA-256 of the uncompressed .gsb (enables the trusted-hash fast path)
 	 * @return True if loaded successfully
 	 */
-	bool LoadSnapshot(const FString& SnapshotPath);
+	bool LoadSnapshot(const FString& SnapshotPath, const FString& ExpectedHash = FString());
+
+	/**
+	 * Check if a background verification of the loaded snapshot is still running.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsVerificationPending() const { return PendingVerification.IsValid() && !PendingVerification.IsReady(); }
 
 	/**
 	 * Get the currently loaded locale.
@@ -49,7 +97,7 @@ public:
 	FLocaleRef GetCurrentLocale() const;
 
 	/**
-	 * Change the current locale (reloads snapshot).
+	 * Change the current locale (reloads snapshot, or only the string table for split layouts).
 	 * Broadcasts OnLocaleChanged after successful reload.
 	 * @return True if locale changed successfully, false otherwise
 	 */
@@ -65,6 +113,121 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "GameScript")
 	FOnLocaleChanged OnLocaleChanged;
 
+	/**
+	 * Apply a binary delta patch (.gsd) to a locale's snapshot and install the result.
+	 *
+	 * Load the updated manifest first: the patched snapshot must match that manifest's hash
+	 * for the locale. The patch is streamed against the installed snapshot (a previous patch or
+	 * the shipped .gsb) into the persistent download directory, verified, then installed.
+	 * Patches may only change text; one that changes anything else (entities, graph, properties,
+	 * tags) is rejected. If the locale is currently loaded, the patched snapshot replaces it (a split
+	 * or chunked layout included, as on the next load) and OnLocaleChanged is broadcast.
+	 *
+	 * @param Locale - Locale the patch targets (from the updated manifest)
+	 * @param PatchPath - Full path to the downloaded .gsd file
+	 * @return True if the patch was verified and installed
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	bool ApplySnapshotPatch(FLocaleRef Locale, const FString& PatchPath);
+
+	// --- Runtime Hot Reload ---
+	// Live tuning on devkits and test servers: re-export and keep playing. Compiled out of shipping builds.
+
+	/**
+	 * Watch the loaded snapshot file and reload it when it changes on disk.
+	 * Enabled automatically by UGameScriptManifest::LoadDatabase() when bRuntimeHotReload is set.
+	 *
+	 * Regular and compressed snapshots are read and verified on a worker thread; split and
+	 * streaming layouts reload on the game thread. Node indices change on reload, so
+	 * OnSnapshotReloading/OnSnapshotReloaded bracket the swap for anything holding refs.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	void SetRuntimeHotReloadEnabled(bool bEnabled);
+
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsRuntimeHotReloadEnabled() const { return HotReloadTicker.IsValid(); }
+
+	/**
+	 * Delegates broadcast around a runtime hot reload.
+	 * Reloading fires while the old snapshot is still loaded (capture IDs from refs here);
+	 * Reloaded fires once the new snapshot, ID maps and resident locales are in place.
+	 */
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSnapshotReload);
+
+	UPROPERTY(BlueprintAssignable, Category = "GameScript")
+	FOnSnapshotReload OnSnapshotReloading;
+
+	UPROPERTY(BlueprintAssignable, Category = "GameScript")
+	FOnSnapshotReload OnSnapshotReloaded;
+
+	/**
+	 * Delegates broadcast when the loaded snapshot is unloaded because background verification
+	 * found it corrupt (see EGSSnapshotVerification::Background).
+	 * Unloading fires while the snapshot is still loaded: runners cancel their conversations here.
+	 * Unloaded fires once nothing is loaded; load a snapshot or change locale to continue.
+	 */
+	DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSnapshotUnload);
+
+	UPROPERTY(BlueprintAssignable, Category = "GameScript")
+	FOnSnapshotUnload OnSnapshotUnloading;
+
+	UPROPERTY(BlueprintAssignable, Category = "GameScript")
+	FOnSnapshotUnload OnSnapshotUnloaded;
+
+	/**
+	 * Native delegate broadcast on the game thread before the loaded snapshot or current-locale
+	 * text is replaced or freed (locale change, reload, streamed block eviction). Worker-thread
+	 * readers holding raw snapshot pointers must finish before their handler returns.
+	 * Readers holding a PinSnapshot() pin are unaffected, except for streamed text.
+	 */
+	FSimpleMulticastDelegate OnSnapshotMemoryReleasing;
+
+	/**
+	 * Pin the currently published snapshot version for reading on any thread.
+	 * Lock-free: an atomic load and a reference count increment. The version's snapshot, ID maps
+	 * and current-locale text stay valid while the pin is held, across locale changes and reloads.
+	 * @return Null pin if nothing is loaded
+	 */
+	FGSSnapshotPin PinSnapshot() const;
+
+	// --- Resident Locales ---
+	// Keep other locales' text loaded next to the current locale (dual-language subtitles,
+	// accessibility captions). Only text is loaded; structure, ID maps and jump tables are shared.
+
+	/**
+	 * Load a locale's text and keep it resident until removed.
+	 * With the split layout only the locale's string table is loaded.
+	 * The locale must come from the same export as the current locale.
+	 * @return True if the locale is resident (including when it is the current locale)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	bool AddResidentLocale(FLocaleRef Locale);
+
+	/**
+	 * Release a locale loaded with AddResidentLocale(). The current locale is unaffected.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	void RemoveResidentLocale(FLocaleRef Locale);
+
+	/**
+	 * Check if a locale's text can be resolved without loading (current or resident).
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsLocaleResident(FLocaleRef Locale) const;
+
+	/**
+	 * Get the current locale's fallback chain (manifest locale indices, nearest first).
+	 * Every locale in the chain is resident while it is current.
+	 */
+	const TArray<int32>& GetFallbackChain() const;
+
+	/**
+	 * Capture the current and resident locales' text for resolution on worker threads.
+	 * Formatting state for every locale is built here, up front; the result is immutable and
+	 * keeps the text it reads alive, including the streamed (chunked) blocks resident now. Game thread.
+	 */
+	TSharedRef<const FGSTextResolver, ESPMode::ThreadSafe> CreateTextResolver() const;
+
 	// --- Entity Count ---
 
 	int32 GetNodeCount() const;
@@ -126,10 +289,147 @@ public:
 	UFUNCTION(BlueprintPure, Category = "GameScript")
 	FPropertyTemplateRef GetPropertyTemplateByIndex(int32 Index) const;
 
+	// --- Property Queries ---
+
+	/**
+	 * Find the nodes whose properties match every filter of a query (see FGSPropertyQuery).
+	 * Each queried property template is indexed column-wise on first use and kept until the
+	 * structure changes, so a query is binary searches plus an intersection, not a snapshot scan.
+	 * @param OutNodes - Matching nodes in node index order (replaced)
+	 */
+	void QueryNodes(const FGSPropertyQuery& Query, TArray<FNodeRef>& OutNodes) const;
+
+	// --- Tag Queries ---
+	// Per-tag-value bitmaps are built at load (see FGSTagIndex); queries never scan the tables.
+
+	/**
+	 * Find conversations by tag (categories AND, values within a category OR; see FGSTagQuery).
+	 * @param OutConversations - Matches in conversation index order (replaced)
+	 */
+	void QueryConversations(const FGSTagQuery& Query, TArray<FConversationRef>& OutConversations) const;
+
+	/**
+	 * Find localizations by tag (categories AND, values within a category OR; see FGSTagQuery).
+	 * @param OutLocalizations - Matches in localization index order (replaced)
+	 */
+	void QueryLocalizations(const FGSTagQuery& Query, TArray<FLocalizationRef>& OutLocalizations) const;
+
+	/**
+	 * Find conversations having every given tag (category name -> value name).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	TArray<FConversationRef> FindConversationsByTags(const TMap<FString, FString>& Tags) const;
+
+	// --- Text Search ---
+	// Trigram index over the current locale's text, built on a worker thread (see FGSTextSearchIndex).
+
+	/**
+	 * Start building the text search index for the current locale and keep it current: later loads
+	 * and locale changes rebuild it in the background. Automatic with UGameScriptSettings::bBuildTextSearchIndex.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	void BuildTextSearchIndex();
+
+	/** Check if the current locale's text search index is built. */
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsTextSearchReady() const { return TextSearchIndex.IsValid(); }
+
+	/**
+	 * Search the current locale's text (case- and diacritic-insensitive; see FGSTextSearchIndex::Search()).
+	 * @return False if the index is not built yet (OutMatches empty)
+	 */
+	bool SearchText(const FString& Query, TArray<FGSTextMatch>& OutMatches, int32 MaxResults = 50, float MinScore = 1.f) const;
+
+	/**
+	 * Find localizations whose text contains every query word (as a word prefix), best match first.
+	 * Empty until the index is built.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	TArray<FLocalizationRef> SearchLocalizations(const FString& Query, int32 MaxResults = 50) const;
+
+	/** Current locale's text search index, for searching on other threads. @return Null until built */
+	TSharedPtr<const FGSTextSearchIndex, ESPMode::ThreadSafe> GetTextSearchIndex() const { return TextSearchIndex; }
+
+	// --- Conversation Streaming ---
+	// Only meaningful for chunked snapshots (.gsc). With a regular .gsb all text is resident:
+	// prefetch/pin calls succeed immediately and every conversation reports resident.
+
+	/**
+	 * Check if this database streams conversation text from a chunked snapshot.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsStreaming() const { return bIsStreaming; }
+
+	/**
+	 * Begin loading a conversation's text in the background (e.g., when approaching an NPC).
+	 * The block is committed on the game thread and then subject to normal LRU eviction.
+	 * @return False if the conversation does not exist
+	 */
+	UFUNCTION(BlueprintCallable, Category = "GameScript")
+	bool PrefetchConversation(int32 ConversationId);
+
+	/**
+	 * Check if a conversation's text is currently in memory.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameScript")
+	bool IsConversationResident(int32 ConversationId) const;
+
+	/**
+	 * Load a conversation's text synchronously and protect it from eviction.
+	 * Pins are reference counted and survive locale changes. Called by the runner
+	 * for the lifetime of each active conversation.
+	 */
+	void PinConversation(int32 ConversationId);
+
+	/**
+	 * Release a pin taken with PinConversation().
+	 */
+	void UnpinConversation(int32 ConversationId);
+
+	/**
+	 * Override the streaming memory budget (defaults to UGameScriptSettings::StreamingBudgetKB).
+	 * Pinned blocks are never evicted, so the resident size may exceed the budget temporarily.
+	 */
+	void SetStreamingBudget(int64 InBudgetBytes);
+
+	/**
+	 * Get the bytes currently held by streamed text blocks.
+	 */
+	int64 GetStreamingResidentBytes() const { return StreamingResidentBytes; }
+
 	// --- Internal Access ---
 
 	const GameScript::Snapshot* GetSnapshot() const { return Snapshot; }
 
+	/**
+	 * Get the snapshot carrying the loaded locale's identity (locale_id, locale_name).
+	 * This is the string table for split layouts; the structure has no locale.
+	 */
+	const GameScript::Snapshot* GetLocaleSnapshot() const { return StringTable ? StringTable : Snapshot; }
+
+	/**
+	 * Get the text-bearing entry for a localization (variants, subject, templating flag).
+	 * All text reads go through here: for chunked snapshots the index entry has no variants,
+	 * so this returns the streamed entry, loading its block on the game thread if needed.
+	 * Keys and tags are only available from GetSnapshot()->localizations().
+	 */
+	const GameScript::Localization* GetLocalizationText(int32 LocalizationIdx) const;
+
+	/**
+	 * Get the text-bearing entry for a localization in a specific locale.
+	 * @param LocaleIndex - Manifest locale index; INDEX_NONE or the current index reads the current locale
+	 * @return Null if the locale is neither current nor resident
+	 */
+	const GameScript::Localization* GetLocalizationText(int32 LocalizationIdx, int32 LocaleIndex) const;
+
+	/**
+	 * Position of a named property within a node's or conversation's properties.
+	 * Binary search over an index built at load (no string conversion).
+	 * @return INDEX_NONE if the entity has no property with that template name
+	 */
+	int32 FindNodePropertyIndex(int32 NodeIndex, FName Name) const { return GetStructure().FindNodeProperty(NodeIndex, Name); }
+	int32 FindConversationPropertyIndex(int32 ConversationIndex, FName Name) const { return GetStructure().FindConversationProperty(ConversationIndex, Name); }
+
 #if WITH_EDITOR
 	/**
 	 * Editor singleton for property drawers.
@@ -138,11 +438,21 @@ public:
 	static UGameScriptDatabase* EditorInstance;
 
 	/**
-	 * Check if snapshot has changed and reload if needed.
-	 * Called by property drawers before data access.
+	 * Check if snapshot has changed and reload if needed (stats the manifest).
+	 * Synchronous; the editor relies on EditorRequestReload() from the data directory watcher instead.
 	 */
 	static void CheckForHotReload();
 
+	/**
+	 * Reload the editor instance after exported files changed (the editor module's directory watcher).
+	 * Requests within EditorReloadDelay are coalesced into one reload: the snapshot is read and
+	 * verified on a worker thread, published on the game thread, then OnEditorDataReloaded fires once.
+	 */
+	static void EditorRequestReload();
+
+	/** Broadcast on the game thread after the editor instance reloaded. */
+	static FSimpleMulticastDelegate OnEditorDataReloaded;
+
 	/**
 	 * Helper methods for property drawers.
 	 */
@@ -160,6 +470,35 @@ public:
 	static bool EditorGetAllLocalizations(TArray<int32>& OutIds, TArray<FString>& OutKeys);
 	static bool EditorGetAllLocales(TArray<int32>& OutIds, TArray<FString>& OutCodes);
 
+	/**
+	 * Pack every locale's .gsb into a chunked snapshot (.gsc) next to it.
+	 * Run after exporting; the runtime prefers .gsc when bStreamConversationText is enabled.
+	 * @return True if every locale was packed
+	 */
+	static bool EditorPackChunkedSnapshots();
+
+	/**
+	 * Compress every locale's .gsb into a block-compressed snapshot (.gsz) next to it.
+	 * The runtime loads .gsz in preference to .gsb when present.
+	 * @return True if every locale was compressed
+	 */
+	static bool EditorCompressSnapshots();
+
+	/**
+	 * Split every locale's .gsb into one shared structure.gss plus a per-locale .gst string table.
+	 * Fails if locales disagree on structure (re-export all locales together).
+	 * The runtime prefers the split layout when both files are present.
+	 * @return True if every locale was split
+	 */
+	static bool EditorSplitSnapshots();
+
+	/**
+	 * Create a binary delta patch that turns one exported .gsb into another.
+	 * Ship the patch alongside the updated manifest.json; games install it via ApplySnapshotPatch().
+	 * @return True if the patch was written
+	 */
+	static bool EditorCreateSnapshotPatch(const FString& BaseSnapshotPath, const FString& TargetSnapshotPath, const FString& PatchPath);
+
 private:
 	// Editor-only state for hot-reload detection
 	static FString EditorBasePath;
@@ -169,18 +508,88 @@ private:
 
 	/** Ensure EditorInstance is initialized and up to date. */
 	static void EnsureEditorInstance();
+
+	// Debounced reload (an export writes the manifest and every locale's snapshot in a burst)
+	static constexpr float EditorReloadDelay = 0.5f;
+	static FTSTicker::FDelegateHandle EditorReloadTicker;
+	static uint32 EditorReloadGeneration;
+
+	/** Start the coalesced reload: worker-thread read for single-file snapshots, in place otherwise. */
+	static void EditorReload();
+
+	/** Reload the manifest and snapshot synchronously, then notify. */
+	static void EditorReloadInPlace();
 #endif
 
 private:
-	// FlatBuffers snapshot (parsed from .gsb file)
+	// Published version owning the snapshot, ID maps and split-layout string table (null if unloaded)
+	FGSSnapshotPin CurrentVersion;
+
+	// Lock-free view of CurrentVersion for PinSnapshot(). A pinner counts itself in the slot of the
+	// epoch it started in until it holds its reference (two-slot epoch counter)
+	std::atomic<const FGSSnapshotVersion*> PublishedVersion{nullptr};
+	std::atomic<uint32> PinEpoch{0};
+	mutable std::atomic<int32> PinnersInEpoch[2]{};
+
+	// Replaced versions a reader may still be pinning: retired ones wait for a grace period,
+	// grace-period ones are released when PinnersInEpoch[GraceEpoch] drains
+	TArray<FGSSnapshotPin> RetiredVersions;
+	TArray<FGSSnapshotPin> GracePeriodVersions;
+	uint32 GraceEpoch = 0;
+	FTSTicker::FDelegateHandle ReclaimTicker;
+
+	// FlatBuffers snapshot (parsed from .gsb file), cached from CurrentVersion
 	const GameScript::Snapshot* Snapshot = nullptr;
 
-	// Buffer backing the snapshot (must outlive Snapshot pointer)
-	TArray<uint8> SnapshotBuffer;
-
 	// Current snapshot path (for reloading)
 	FString CurrentSnapshotPath;
 
+	// Split layout: per-locale string table aligned by localization index with the structure
+	const GameScript::Snapshot* StringTable = nullptr;
+	FString CurrentStructurePath;
+
+	/**
+	 * Make a version current and visible to PinSnapshot(). Game thread; never waits for readers.
+	 * The previous version is released once no reader is between loading and pinning it.
+	 */
+	void PublishVersion(FGSSnapshotPin NewVersion);
+
+	/**
+	 * Advance the grace period and release the replaced versions no reader can still be pinning.
+	 * Game thread; non-blocking. @return true while replaced versions are still held
+	 */
+	bool ReclaimRetiredVersions();
+
+	/** Structure of the current version (empty if nothing is loaded). */
+	const FGSSnapshotStructure& GetStructure() const;
+
+	// Lazily built property columns by template index (cleared when the structure changes)
+	mutable TMap<int32, TSharedPtr<const FGSPropertyColumn>> PropertyColumns;
+
+	// Text search index of CurrentVersion (null while building or not requested)
+	TSharedPtr<const FGSTextSearchIndex, ESPMode::ThreadSafe> TextSearchIndex;
+	uint32 TextSearchBuildVersion = 0;   // Version whose index is building or built
+	bool bKeepTextSearchIndex = false;
+
+	/** Build the index for CurrentVersion on a worker thread, unless built or building. */
+	void StartTextSearchBuild();
+
+	// Additional resident locales: text snapshots aligned by localization index with Snapshot
+	struct FResidentLocale
+	{
+		TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Buffer;   // Shared with text resolvers
+		const GameScript::Snapshot* Text = nullptr;
+		bool bRequested = false;   // Added via AddResidentLocale (otherwise held for the fallback chain)
+	};
+	TMap<int32, FResidentLocale> ResidentLocales;  // Manifest locale index -> text
+
+	bool LoadResidentLocale(int32 LocaleIndex, bool bRequested);
+
+	/**
+	 * Make the current locale's fallback chain resident and release fallbacks no longer needed.
+	 */
+	void RefreshFallbackLocales();
+
 	// Manifest reference (for locale switching - weak to avoid circular GC reference)
 	TWeakObjectPtr<class UGameScriptManifest> Manifest;
 
@@ -190,18 +599,110 @@ private:
 	// Currently loaded locale index (for GetCurrentLocale)
 	int32 CurrentLocaleIndex = -1;
 
-	// ID to index maps (for O(log N) lookup by ID)
-	TMap<int32, int32> NodeIdToIndex;
-	TMap<int32, int32> ConversationIdToIndex;
-	TMap<int32, int32> ActorIdToIndex;
-	TMap<int32, int32> LocalizationIdToIndex;
-	TMap<int32, int32> EdgeIdToIndex;
-	TMap<int32, int32> PropertyTemplateIdToIndex;
+	/**
+	 * Read a snapshot file, decompressing and verifying it. Logs and returns false on failure.
+	 * @param ExpectedHash - Manifest hash; with bTrustManifestHash a match skips verification
+	 * @param bOutVerifyPending - If given and the Background policy applies, verification is left to
+	 *                            the caller (via CommitSnapshot) and this is set to true
+	 */
+	static bool ReadSnapshotFile(const FString& SnapshotPath, TArray<uint8>& OutBuffer,
+		const FString& ExpectedHash = FString(), bool* bOutVerifyPending = nullptr);
 
 	/**
-	 * Build ID-to-index maps after loading snapshot.
+	 * Publish a new version built from a buffer (rebuilds ID maps).
+	 * Clears streaming state; the string table is replaced by TableBuffer (split layout) or cleared.
+	 * @param bVerifyPending - Buffer is unverified; verify it on a worker thread
 	 */
-	void BuildIdMaps();
+	void CommitSnapshot(TArray<uint8>&& Buffer, const FString& SnapshotPath, bool bVerifyPending = false,
+		TArray<uint8>&& TableBuffer = TArray<uint8>());
+
+	/** Drop the resident snapshot (after a failed background verification), bracketed by OnSnapshotUnloading/Unloaded. */
+	void UnloadSnapshot();
+
+	// --- Background Verification ---
+	// The task keeps the structure it verifies alive; loads still wait for it before publishing.
+
+	TFuture<bool> PendingVerification;
+	uint32 VerificationGeneration = 0;
+
+	void StartBackgroundVerification();
+	void WaitForBackgroundVerification();
+
+	bool LoadSplitSnapshot(const FString& StringTablePath);
+
+	// --- Runtime Hot Reload State ---
+
+	FTSTicker::FDelegateHandle HotReloadTicker;
+	FString HotReloadPath;                   // CurrentSnapshotPath the time stamp belongs to
+	FDateTime HotReloadTimeStamp;            // Newest write time of the watched files at last (re)load
+	uint32 HotReloadGeneration = 0;          // Bumped on enable/disable so stale background reads are dropped
+	bool bHotReloadInFlight = false;
+
+	bool TickRuntimeHotReload(float DeltaTime);
+	FDateTime GetSnapshotTimeStamp() const;
+	void CommitRuntimeHotReload(TFunctionRef<bool()> Reload);
+
+	// --- Streaming State (chunked snapshots only) ---
+	// Mutable: GetLocalizationText() is const but may fault in a block on the game thread.
+
+	struct FStreamedBlock
+	{
+		int32 ConversationId = -1;
+		uint32 Offset = 0;
+		uint32 Size = 0;
+		TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Buffer;   // Null when not resident; shared with text resolvers
+		uint64 LastUseTick = 0;
+		bool bPending = false;       // Background prefetch in flight
+	};
+
+	bool bIsStreaming = false;
+	mutable TArray<FStreamedBlock> StreamedBlocks;
+	mutable TArray<const GameScript::Localization*> StreamedLocalizations;  // Per localization index, null if not resident
+	TArray<int32> LocalizationBlocks;        // Owning block per localization index, -1 = resident in index
+	TMap<int32, int32> ConversationIdToBlock;
+	TMap<int32, int32> ConversationPins;     // Conversation ID -> pin count (kept across reloads)
+	mutable int64 StreamingResidentBytes = 0;
+	mutable uint64 StreamingTick = 0;
+	int64 StreamingBudgetBytes = -1;         // -1 = read from settings on first chunked load
+	uint32 StreamingGeneration = 0;          // Bumped on reload so stale prefetches are dropped
+
+	// --- Multi-File Layouts ---
+	// Split and chunked snapshots are read (any thread) and committed (game thread) separately,
+	// so runtime hot reload can read them on a worker thread.
+
+	struct FSnapshotFiles
+	{
+		TArray<uint8> Structure;                 // Structure (split) or resident index (chunked); empty = keep the resident structure
+		TArray<uint8> StringTable;               // Split layout
+		TArray<FStreamedBlock> Blocks;           // Chunked layout: block table (nothing resident)
+		TArray<int32> LocalizationBlocks;        // Chunked layout: owning block per localization index
+	};
+
+	/**
+	 * Read a locale's string table and, if bReadStructure, its structure. Logs and returns false on failure.
+	 * @param bOutVerifyPending - As for ReadSnapshotFile (structure only)
+	 */
+	static bool ReadSplitSnapshot(const FString& StringTablePath, bool bReadStructure, FSnapshotFiles& OutFiles,
+		bool* bOutVerifyPending = nullptr);
+
+	/** Publish read split files (against the resident structure if none was read). @return false if they do not match */
+	bool CommitSplitSnapshot(const FString& StringTablePath, FSnapshotFiles&& Files, bool bVerifyPending = false);
+
+	/** Read and verify a chunked snapshot's header, block table and index. Logs and returns false on failure. */
+	static bool ReadChunkedSnapshot(const FString& SnapshotPath, FSnapshotFiles& OutFiles);
+
+	/** Publish a read chunked snapshot and start streaming from it. */
+	void CommitChunkedSnapshot(const FString& SnapshotPath, FSnapshotFiles&& Files);
+
+	bool LoadChunkedSnapshot(const FString& SnapshotPath);
+	void ResetStreamingState();
+	bool LoadStreamedBlock(int32 BlockIdx) const;
+	void CommitStreamedBlock(int32 BlockIdx, TArray<uint8>&& Buffer) const;
+	void EvictStreamedBlock(int32 BlockIdx) const;
+
+	/** Evict LRU unpinned blocks until under budget. @param KeepBlockIdx - Block never evicted (the one being committed) */
+	void EnforceStreamingBudget(int32 KeepBlockIdx = INDEX_NONE) const;
+	static bool ReadStreamedBlock(const FString& Path, uint32 Offset, uint32 Size, TArray<uint8>& OutBuffer);
 
 	/**
 	 * Template helper: Get collection count from snapshot.
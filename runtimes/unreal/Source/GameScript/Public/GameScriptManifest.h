@@ -30,6 +30,9 @@ struct GAMESCRIPT_API FManifestLocale
 
 	UPROPERTY(BlueprintReadOnly, Category = "GameScript")
 	FString Hash;  // Snapshot hash for hot-reload detection
+
+	UPROPERTY(BlueprintReadOnly, Category = "GameScript")
+	FString Fallback;  // Optional locale name to use for missing text, e.g., "pt_PT" for "pt_BR"
 };
 
 /**
@@ -161,6 +164,18 @@ public:
 	// Internal: Get locale metadata by index (for FLocaleRef)
 	const FManifestLocale& GetLocaleMetadata(int32 Index) const;
 
+	// Internal: Resolve the snapshot file for a locale index
+	// (installed patch matching the manifest hash, then .gsc when streaming is enabled,
+	// then .gst with a shared structure.gss, then .gsz, then .gsb)
+	FString GetSnapshotPath(int32 Index, bool bAllowStreaming = true) const;
+
+	// Internal: Writable location where patched snapshots for a locale index are installed
+	FString GetPatchedSnapshotPath(int32 Index) const;
+
+	// Internal: Locale indices to try, in order, when text is missing in a locale
+	// (follows each locale's "fallback" field; excludes the locale itself)
+	const TArray<int32>& GetFallbackChain(int32 Index) const;
+
 private:
 	UPROPERTY()
 	FString BasePath;
@@ -171,4 +186,7 @@ private:
 
 	// Primary locale index (not ID - index into Locales array)
 	int32 PrimaryLocaleIndex = -1;
+
+	// Resolved fallback chains per locale index (built in Initialize)
+	TArray<TArray<int32>> FallbackChains;
 };
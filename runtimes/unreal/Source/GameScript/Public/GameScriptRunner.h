@@ -3,17 +3,21 @@
 #include "CoreMinimal.h"
 #include "Attributes.h"
 #include "ActiveConversation.h"
+#include "ConversationSave.h"
+#include "ConversationRecorder.h"
 #include "IGameScriptListener.h"
 #include "TextResolutionParams.h"
-#include "Internationalization/Culture.h"
+#include "TextResolver.h"
 #include "GameScriptRunner.generated.h"
 
 // Forward declarations
 class UGameScriptDatabase;
 class UGameScriptSettings;
-class URunnerContext;
+class FRunnerContext;
+class FRunnerContextPool;
 class UGSCompletionHandle;
 class AActor;
+struct FGSReplayScript;
 namespace GameScript { struct Snapshot; struct Localization; }
 
 /**
@@ -29,8 +33,10 @@ namespace GameScript { struct Snapshot; struct Localization; }
  *
  * Features:
  * - O(1) action/condition dispatch via array-indexed jump tables
- * - Pooled RunnerContext for zero-allocation conversation start
+ * - Pooled RunnerContext for zero-allocation conversation start (plain C++, outside the GC graph)
  * - Multiple concurrent conversations supported
+ * - Running conversations survive a runtime hot reload (remapped by node ID)
+ * - Always-on ring-buffer recorder with deterministic replay of recorded conversations
  * - UObject lifecycle management for GC safety
  *
  * Usage Examples:
@@ -119,6 +125,9 @@ class GAMESCRIPT_API UGameScriptRunner : public UObject
 public:
 	UGameScriptRunner();
 
+	/** Reports the object references held by active conversation contexts. */
+	static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
 	/**
 	 * Initialize the runner with a database and settings.
 	 * Must be called after construction via NewObject.
@@ -139,6 +148,59 @@ public:
 		AActor* TaskOwner
 	);
 
+	/**
+	 * Start a conversation at a specific node instead of its root.
+	 * OnConversationEnter is called as usual, then the node is entered directly
+	 * (a root node goes straight to edge evaluation).
+	 * @param NodeId - Database ID of a node in the conversation
+	 * @return Handle for querying/stopping the conversation (invalid if the node is not in it)
+	 */
+	FActiveConversation StartConversationAtNode(
+		int32 ConversationId,
+		int32 NodeId,
+		TScriptInterface<IGameScriptListener> Listener,
+		AActor* TaskOwner
+	);
+
+	/**
+	 * Record where a running conversation can be resumed (e.g., for a save game).
+	 * Waiting on a decision saves the decision; anywhere else saves the node being played
+	 * (or the next node once a node is exiting).
+	 * @return False if the handle is stale or the conversation is ending
+	 */
+	bool SaveConversation(FActiveConversation Handle, FGSConversationSave& OutSave) const;
+
+	/**
+	 * Resume a conversation saved with SaveConversation() without replaying earlier nodes.
+	 * A saved decision re-evaluates its edge conditions; if the resulting choices differ from
+	 * the saved fingerprint, the current choices are used and a warning is logged.
+	 * @return Handle for the resumed conversation (invalid if the record no longer resolves)
+	 */
+	FActiveConversation RestoreConversation(
+		const FGSConversationSave& Save,
+		TScriptInterface<IGameScriptListener> Listener,
+		AActor* TaskOwner
+	);
+
+	/**
+	 * Get the event recorder (sized by UGameScriptSettings::ConversationRecorderCapacity).
+	 * Save its contents with FGSConversationRecorder::SaveToFile() when filing a bug.
+	 */
+	FGSConversationRecorder& GetRecorder() { return Recorder; }
+	const FGSConversationRecorder& GetRecorder() const { return Recorder; }
+
+	/**
+	 * Replay a recorded conversation through a fresh runner context.
+	 * Conditions return their recorded results and actions are skipped; a built-in listener
+	 * completes each event on the next game-thread tick and makes the recorded choices. The replay is recorded
+	 * like any conversation, so its events can be compared with the original.
+	 * Divergence (a condition or choice that no longer lines up) is logged.
+	 * @param Events - Recording, e.g. from FGSConversationRecorder::LoadFromFile()
+	 * @param StartIndex - Index of the conversation's Start event (see FGSConversationRecorder::FindLastStart)
+	 * @param TaskOwner - Actor that owns the replayed conversation
+	 */
+	FActiveConversation ReplayConversation(TConstArrayView<FGSRecordedEvent> Events, int32 StartIndex, AActor* TaskOwner);
+
 	/**
 	 * Stop a running conversation (triggers cancellation).
 	 */
@@ -178,8 +240,31 @@ public:
 	 */
 	const TArray<ActionDelegate>& GetActions() const { return Actions; }
 
+	/**
+	 * Whether a node's condition was registered with NODE_CONDITION_VOLATILE (for RunnerContext).
+	 */
+	bool IsConditionVolatile(int32 NodeIndex) const
+	{
+		return VolatileConditions.IsValidIndex(NodeIndex) && VolatileConditions[NodeIndex];
+	}
+
+	/**
+	 * Whether a node's condition may run on a worker thread (for RunnerContext).
+	 */
+	bool IsConditionThreadSafe(int32 NodeIndex) const
+	{
+		return ThreadSafeConditions.IsValidIndex(NodeIndex) && ThreadSafeConditions[NodeIndex];
+	}
+
+	/**
+	 * Mark a node's condition as safe (or unsafe) to evaluate on worker threads, overriding its
+	 * registration (see NODE_CONDITION_THREADSAFE). Kept across runtime hot reloads.
+	 */
+	void SetConditionThreadSafe(int32 NodeId, bool bThreadSafe);
+
 	/**
 	 * Acquire a completion handle from the pool (for RunnerContext).
+	 * Blueprint listeners only; native listeners receive an FGSCompletionToken instead.
 	 * @return A completion handle that must be released via ReleaseHandle()
 	 */
 	UGSCompletionHandle* AcquireHandle();
@@ -192,7 +277,8 @@ public:
 	/**
 	 * Resolves the text for a localization entry with the given parameters.
 	 * Performs gender resolution, plural category selection, variant picking,
-	 * and template substitution in a single pass.
+	 * and template substitution in a single pass. Falls back along the current
+	 * locale's manifest fallback chain when the translation is missing.
 	 *
 	 * @param LocalizationIdx Index into snapshot.Localizations. Returns empty string if < 0.
 	 * @param Node The node context (for future dynamic gender support).
@@ -201,9 +287,28 @@ public:
 	 */
 	FString ResolveText(int32 LocalizationIdx, FNodeRef Node, const FTextResolutionParams& Parms);
 
+	/**
+	 * Resolves text in an explicit locale (e.g., dual-language subtitles or captions).
+	 * The locale must be the database's current locale or resident via
+	 * UGameScriptDatabase::AddResidentLocale(); plural rules and number formatting follow it.
+	 *
+	 * Missing text walks the locale's manifest fallback chain (e.g., pt_BR -> pt_PT -> en_US);
+	 * fallbacks of the current locale are always resident.
+	 *
+	 * @param Locale The locale to resolve in. Invalid ref means the current locale.
+	 * @return The resolved string, or empty if no resident locale in the chain has text.
+	 */
+	FString ResolveText(int32 LocalizationIdx, FNodeRef Node, const FTextResolutionParams& Parms, FLocaleRef Locale);
+
 private:
-	// URunnerContext needs access to ReleaseContext for self-cleanup
-	friend class URunnerContext;
+	// FRunnerContext needs access to ReleaseContext for self-cleanup
+	friend class FRunnerContext;
+
+	// Tokens resolve their context through ValidateHandle
+	friend struct FGSCompletionToken;
+
+	// Look-ahead reads the cached locale formats
+	friend class FGSTextPrefetch;
 
 	UPROPERTY()
 	TObjectPtr<UGameScriptDatabase> Database;
@@ -214,69 +319,102 @@ private:
 	// Jump tables (built once at initialization)
 	TArray<ConditionDelegate> Conditions;
 	TArray<ActionDelegate> Actions;
+	TBitArray<> VolatileConditions;
+	TBitArray<> ThreadSafeConditions;
+	TMap<int32, bool> ThreadSafeOverrides;   // Node ID -> SetConditionThreadSafe() value
 
-	// Pool of reusable contexts (GC-protected)
-	// Using TArray as a simple free-list for idle contexts
-	UPROPERTY()
-	TArray<TObjectPtr<URunnerContext>> ContextPool;
+	// Generational slot map of contexts. A context keeps its slot for the runner's lifetime;
+	// FActiveConversation is (slot, generation) and release bumps the generation.
+	// Contexts are plain C++ objects in chunked storage: their task and handle references are
+	// reported by AddReferencedObjects, so GC cost does not grow with the pool
+	TSharedPtr<FRunnerContextPool> ContextPool;
+	TArray<int32> SlotGenerations;
 
-	// Active contexts mapped by ContextId for O(1) lookup
-	// TMap provides stable access even when other contexts are released
-	UPROPERTY()
-	TMap<int32, TObjectPtr<URunnerContext>> ActiveContexts;
+	// Idle slots (LIFO free list, O(1) acquire/release)
+	TArray<int32> FreeSlots;
+
+	// Slots of acquired contexts, densely packed for iteration; ActivePositions maps a slot to its
+	// position here (INDEX_NONE when free) so release is a swap-remove
+	TArray<int32> ActiveSlots;
+	TArray<int32> ActivePositions;
 
 	// Pool of reusable completion handles (GC-protected)
 	UPROPERTY()
 	TArray<TObjectPtr<UGSCompletionHandle>> HandlePool;
 
-	// Sequence counter for handle validation
-	int32 NextSequence = 1;
+	// Ring buffer of recent events from all contexts
+	FGSConversationRecorder Recorder;
+
+	// Listeners driving replays (referenced here for GC; pruned when finished)
+	UPROPERTY()
+	TArray<TObjectPtr<UObject>> ReplayListeners;
 
 	/**
-	 * Validate a conversation handle and return the context if valid.
+	 * Validate a conversation handle and return the context if valid (slot index + generation compare).
 	 * @return Context pointer if valid, nullptr otherwise
 	 */
-	URunnerContext* ValidateHandle(FActiveConversation Handle) const;
+	FRunnerContext* ValidateHandle(FActiveConversation Handle) const;
+
+	/**
+	 * Shared start path: validates, acquires and starts a context.
+	 * @param ResumeNode - Node to start at (invalid = conversation root)
+	 * @param ResumeFingerprint - Expected choice fingerprint when resuming at a decision
+	 * @param Replay - Recorded conditions to use instead of evaluating them (replay only)
+	 */
+	FActiveConversation StartConversationInternal(
+		FConversationRef Conv,
+		FNodeRef ResumeNode,
+		bool bResumeAtDecision,
+		int32 ResumeFingerprint,
+		TScriptInterface<IGameScriptListener> Listener,
+		AActor* TaskOwner,
+		TSharedPtr<FGSReplayScript> Replay = nullptr
+	);
 
 	/**
 	 * Acquire a context from the pool.
+	 * @param OutHandle - Handle for the acquired slot
 	 */
-	URunnerContext* AcquireContext();
+	FRunnerContext* AcquireContext(FActiveConversation& OutHandle);
 
 	/**
 	 * Return a context to the pool.
 	 */
-	void ReleaseContext(URunnerContext* Context);
+	void ReleaseContext(FRunnerContext* Context);
 
 	/**
 	 * Build jump tables from global registrations.
 	 */
 	void BuildJumpTables();
 
-	// Text resolution helpers
-	static EGSGenderCategory ResolveGender(const GameScript::Localization* Loc, const FTextResolutionParams& Parms, const GameScript::Snapshot* Snapshot);
-	FString ApplyTemplate(const FString& Text, const FTextResolutionParams& Parms);
-	void FormatArg(const FGSArg& Arg, FString& OutResult);
+	// Text resolution helper (formatting itself lives in FGSTextResolver)
+	FString ResolveTextInLocale(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale);
 
 	// Shared string builder for template substitution (not re-entrant; game thread only)
 	FString SharedStringBuilder;
 
-	// Cached locale culture info (invalidated on locale change)
-	FString CachedLocaleName;
-	FCulturePtr CachedCulture;
+	// Cached formatting state keyed by manifest locale index, INDEX_NONE = current locale
+	// (invalidated on locale change)
+	TMap<int32, FGSLocaleFormat> LocaleFormats;
 
-	// Cached CLDR rule indices (avoids per-call locale normalization)
-	uint8 CachedCardinalRuleIdx = 0;
-	uint8 CachedOrdinalRuleIdx = 0;
-	bool bCldrRulesCached = false;
-
-	// Locale caching helpers
-	FCulturePtr GetCulture();
-	void EnsureCldrRulesCached(const GameScript::Snapshot* Snapshot);
+	// Locale caching helper
+	const FGSLocaleFormat& GetLocaleFormat(FLocaleRef Locale);
 
 	UFUNCTION()
 	void OnLocaleChanged();
 
-	// Power of 10 for decimal formatting
-	static double Pow10(int32 Exponent);
+	// Runtime hot reload: capture node IDs before the swap, remap (or cancel) after it
+	UFUNCTION()
+	void OnSnapshotReloading();
+
+	UFUNCTION()
+	void OnSnapshotReloaded();
+
+	// Background verification failure: cancel every conversation before the snapshot goes
+	UFUNCTION()
+	void OnSnapshotUnloading();
+
+	// Look-ahead tasks read snapshot memory; finish them before the database frees it
+	void WaitForTextPrefetch();
+	void ResetTextPrefetch();
 };
@@ -22,6 +22,19 @@ struct GAMESCRIPT_API FGSExecutablePath
 	bool IsEmpty() const { return Path.IsEmpty(); }
 };
 
+/**
+ * When loaded snapshots are structurally verified.
+ */
+UENUM()
+enum class EGSSnapshotVerification : uint8
+{
+	/** Verify the whole snapshot on the loading thread before it is used. */
+	Full,
+
+	/** Bounds-check only the indexed fields, use the snapshot, and verify the rest on a worker thread; a failed check cancels running conversations and unloads it. */
+	Background
+};
+
 /**
  * Project settings for GameScript.
  * Accessible via Project Settings -> Plugins -> GameScript
@@ -61,6 +74,105 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "Runtime")
 	bool bPreventSingleNodeChoices;
 
+	/**
+	 * When enabled, a node's outgoing choices (conditions and UI response text) are evaluated
+	 * while its speech is still playing, so the decision is ready when it finishes. Only
+	 * conditions registered with NODE_CONDITION_VOLATILE are evaluated again afterwards.
+	 * Nodes whose latent action is still running are evaluated when it finishes, as usual.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime")
+	bool bSpeculativeChoices;
+
+	/**
+	 * When enabled, conditions registered with NODE_CONDITION_THREADSAFE (or marked via
+	 * UGameScriptRunner::SetConditionThreadSafe) are evaluated on worker threads when a node has
+	 * at least ParallelConditionThreshold of them. Results are consumed in edge order, so choices
+	 * and recordings are identical to serial evaluation.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime")
+	bool bParallelConditions;
+
+	/**
+	 * Minimum number of thread-safe conditions on a node's outgoing edges before they fan out.
+	 * Below it, dispatch overhead outweighs the gain and conditions run on the game thread.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime", meta=(ClampMin="2", EditCondition="bParallelConditions"))
+	int32 ParallelConditionThreshold;
+
+	/**
+	 * Edge levels of upcoming lines to resolve on worker threads while the current node plays
+	 * (unconditional edges and the highest-priority edge group). The listener's OnSpeechParams and
+	 * OnDecisionParams are called ahead of time for those nodes. 0 disables.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime", meta=(ClampMin="0", ClampMax="8"))
+	int32 LookAheadDepth;
+
+	/**
+	 * Number of recent runner events (transitions, condition results, choices) each runner keeps
+	 * for bug reports and replay. Rounded up to a power of two; 24 bytes per event. 0 disables.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Runtime", meta=(ClampMin="0"))
+	int32 ConversationRecorderCapacity;
+
+	/**
+	 * When enabled, databases load chunked snapshots (.gsc) if present and stream each
+	 * conversation's text on demand instead of keeping every locale string resident.
+	 * Pack chunked snapshots via Tools -> GameScript -> Pack Streaming Snapshots after exporting.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Streaming")
+	bool bStreamConversationText;
+
+	/**
+	 * Memory budget for streamed conversation text, in KB.
+	 * Least-recently-used blocks of inactive conversations are evicted above this size.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Streaming", meta=(ClampMin="0", EditCondition="bStreamConversationText"))
+	int32 StreamingBudgetKB;
+
+	/**
+	 * When snapshots are structurally verified on load.
+	 * Background shortens cold loads; the snapshot is provisionally usable until the check completes.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Loading")
+	EGSSnapshotVerification SnapshotVerification;
+
+	/**
+	 * Trusted builds only: skip structural verification when the SHA-256 computed while reading
+	 * a snapshot matches its manifest hash. Mismatches fall back to SnapshotVerification.
+	 * Leave disabled where snapshots can be modified outside the shipped manifest (e.g., mods).
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Loading")
+	bool bTrustManifestHash;
+
+	/**
+	 * Build a trigram search index over the current locale's text on a worker thread after every
+	 * load and locale change (UGameScriptDatabase::SearchText). Enable for in-game codex search;
+	 * databases can also opt in with BuildTextSearchIndex().
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Loading")
+	bool bBuildTextSearchIndex;
+
+	/**
+	 * Watch the loaded snapshot and reload it when it is re-exported, remapping running
+	 * conversations by node ID. For live tuning on devkits and test servers; ignored in shipping builds.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Development")
+	bool bRuntimeHotReload;
+
+	/**
+	 * Seconds between snapshot file checks when bRuntimeHotReload is enabled.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Development", meta=(ClampMin="0.1", EditCondition="bRuntimeHotReload"))
+	float RuntimeHotReloadInterval;
+
+	/**
+	 * FCompression codec used when packing snapshots (Pack Streaming Snapshots / Compress Snapshots).
+	 * None packs streaming snapshots uncompressed; Compress Snapshots then falls back to Zlib.
+	 * Supported: Oodle, Zlib, Gzip, LZ4.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Packaging")
+	FName SnapshotCompressionFormat;
+
 	/**
 	 * Enable verbose logging for debugging.
 	 */
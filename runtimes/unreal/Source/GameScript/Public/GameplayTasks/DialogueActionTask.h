@@ -45,6 +45,13 @@ public:
 	 */
 	FOnDialogueTaskComplete& GetOnCancelled() { return OnCancelled; }
 
+	/**
+	 * Native counterparts of OnCompleted / OnCancelled (broadcast alongside them).
+	 * Used by the runner, whose conversation contexts are not UObjects.
+	 */
+	FSimpleMulticastDelegate& GetOnCompletedNative() { return OnCompletedNative; }
+	FSimpleMulticastDelegate& GetOnCancelledNative() { return OnCancelledNative; }
+
 protected:
 	/**
 	 * Override to perform the action work.
@@ -60,6 +67,7 @@ protected:
 		if (!bInOwnerFinished)
 		{
 			OnCancelled.Broadcast();
+			OnCancelledNative.Broadcast();
 		}
 
 		Super::OnDestroy(bInOwnerFinished);
@@ -71,6 +79,11 @@ protected:
 	void CompleteTask()
 	{
 		OnCompleted.Broadcast();
+		OnCompletedNative.Broadcast();
 		EndTask();
 	}
+
+private:
+	FSimpleMulticastDelegate OnCompletedNative;
+	FSimpleMulticastDelegate OnCancelledNative;
 };
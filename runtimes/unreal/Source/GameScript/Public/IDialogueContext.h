@@ -48,6 +48,9 @@ public:
 	virtual int32 GetPropertyCount() const = 0;
 	virtual FNodePropertyRef GetProperty(int32 Index) const = 0;
 
+	// Custom property by template name (invalid ref if absent); hold names in static FNames
+	virtual FNodePropertyRef FindProperty(FName Name) const = 0;
+
 	// Task creation factory (for latent actions)
 	// Returns the GameplayTasksComponent that owns conversation tasks
 	virtual UGameplayTasksComponent* GetTaskOwner() const = 0;
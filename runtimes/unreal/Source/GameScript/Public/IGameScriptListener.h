@@ -6,8 +6,9 @@
 #include "TextResolutionParams.h"
 #include "IGameScriptListener.generated.h"
 
-// Forward declaration
+// Forward declarations
 class UGSCompletionHandle;
+class IGameScriptNativeListener;
 
 /**
  * UInterface declaration for GameScript listener.
@@ -47,12 +48,22 @@ class UGameScriptListener : public UInterface
  * - Handle is safe to store temporarily (in timers, callbacks, etc.)
  * - Handle automatically invalidates after use or if conversation is cancelled
  * - Multiple conversations can safely use the same listener object
+ *
+ * C++ Listeners:
+ * - Override GetNativeListener() to receive every event through IGameScriptNativeListener
+ *   (plain virtual calls with an FGSCompletionToken, no Execute_ thunks or handle objects)
  */
 class GAMESCRIPT_API IGameScriptListener
 {
 	GENERATED_BODY()
 
 public:
+	/**
+	 * Native listener that replaces every event below (checked once per conversation).
+	 * C++ only; Blueprint implementations always use the events below.
+	 */
+	virtual IGameScriptNativeListener* GetNativeListener() { return nullptr; }
+
 	// --- Lifecycle Events (Async - require completion signal) ---
 
 	UFUNCTION(BlueprintNativeEvent, Category = "GameScript|Lifecycle")
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Refs.h"
+#include "TextResolutionParams.h"
+#include "GSCompletionToken.h"
+
+/**
+ * Native (C++) listener for dialogue execution events.
+ *
+ * Same events as IGameScriptListener, but as plain virtual calls: no Execute_ thunks, no
+ * reflection marshaling of parameters (refs by const&, choices as a TConstArrayView over the
+ * runner's array) and an FGSCompletionToken instead of a pooled UGSCompletionHandle. Use it for
+ * C++ UI and AI layers that never need Blueprint overrides.
+ *
+ * Usage: implement both interfaces and return this from GetNativeListener(). The runner checks
+ * once per conversation (at context initialization); when a native listener is present, every
+ * event, including the params and auto-decision queries and look-ahead text, goes to it instead
+ * of the IGameScriptListener events.
+ *
+ * \code
+ * class UMyDialogueAI : public UObject, public IGameScriptListener, public IGameScriptNativeListener
+ * {
+ *     virtual IGameScriptNativeListener* GetNativeListener() override { return this; }
+ *
+ *     virtual void OnDecision(TConstArrayView<FChoiceRef> Choices, FGSCompletionToken Token) override
+ *     {
+ *         Token.SelectChoiceByIndex(PickBest(Choices));
+ *     }
+ * };
+ * \endcode
+ *
+ * Events that are not overridden complete immediately and queries return the same defaults as
+ * IGameScriptListener. OnDecision must be implemented.
+ */
+class GAMESCRIPT_API IGameScriptNativeListener
+{
+public:
+	virtual ~IGameScriptNativeListener() = default;
+
+	// --- Lifecycle Events (Async - require completion signal) ---
+
+	virtual void OnConversationEnter(const FConversationRef& Conversation, FGSCompletionToken Token) { Token.NotifyReady(); }
+	virtual void OnNodeEnter(const FNodeRef& Node, FGSCompletionToken Token) { Token.NotifyReady(); }
+
+	/** Params for resolving a node's voice text (see IGameScriptListener::OnSpeechParams). */
+	virtual FTextResolutionParams OnSpeechParams(const FLocalizationRef& Localization, const FNodeRef& Node) { return FTextResolutionParams(); }
+
+	/** Params for resolving a choice's UI response text (see IGameScriptListener::OnDecisionParams). */
+	virtual FTextResolutionParams OnDecisionParams(const FLocalizationRef& Localization, const FNodeRef& Node) { return FTextResolutionParams(); }
+
+	/** Speech for a dialogue node; VoiceText is fully resolved (see IGameScriptListener::OnSpeech). */
+	virtual void OnSpeech(const FNodeRef& Node, const FString& VoiceText, FGSCompletionToken Token) { Token.NotifyReady(); }
+
+	/** Player choice; complete with Token.SelectChoice() or Token.SelectChoiceByIndex(). */
+	virtual void OnDecision(TConstArrayView<FChoiceRef> Choices, FGSCompletionToken Token) = 0;
+
+	virtual void OnNodeExit(const FNodeRef& Node, FGSCompletionToken Token) { Token.NotifyReady(); }
+	virtual void OnConversationExit(const FConversationRef& Conversation, FGSCompletionToken Token) { Token.NotifyReady(); }
+
+	// --- Async Cleanup Events (require completion signal, no cancellation) ---
+
+	virtual void OnConversationCancelled(const FConversationRef& Conversation, FGSCompletionToken Token) { Token.NotifyReady(); }
+	virtual void OnError(const FConversationRef& Conversation, const FString& ErrorMessage, FGSCompletionToken Token) { Token.NotifyReady(); }
+	virtual void OnCleanup(const FConversationRef& Conversation, FGSCompletionToken Token) { Token.NotifyReady(); }
+
+	// --- Synchronous Events ---
+
+	/**
+	 * Pick the choice to auto-advance to (see IGameScriptListener::OnAutoDecision).
+	 * Default implementation selects randomly among the choices.
+	 */
+	virtual FChoiceRef OnAutoDecision(TConstArrayView<FChoiceRef> Choices)
+	{
+		return Choices.Num() > 0 ? Choices[FMath::RandRange(0, Choices.Num() - 1)] : FChoiceRef();
+	}
+};
@@ -26,11 +26,15 @@ public:
 	 * @param Database - Snapshot data source (for node ID to index mapping)
 	 * @param OutConditions - Output array sized to node count
 	 * @param OutActions - Output array sized to node count
+	 * @param OutVolatileConditions - Optional bit per node, set for NODE_CONDITION_VOLATILE conditions
+	 * @param OutThreadSafeConditions - Optional bit per node, set for NODE_CONDITION_THREADSAFE conditions
 	 */
 	static void BuildJumpTables(
 		const UGameScriptDatabase* Database,
 		TArray<ConditionDelegate>& OutConditions,
-		TArray<ActionDelegate>& OutActions
+		TArray<ActionDelegate>& OutActions,
+		TBitArray<>* OutVolatileConditions = nullptr,
+		TBitArray<>* OutThreadSafeConditions = nullptr
 	);
 
 	/**
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Query over node property values: every filter must match (AND).
+ * Run with UGameScriptDatabase::QueryNodes(); filters name properties by template name.
+ *
+ * String properties support Equals; integer, decimal and boolean properties support Equals and
+ * the range filters (booleans compare as 0/1). A filter on an unknown property or of the wrong
+ * kind for the property's type matches nothing.
+ *
+ * \code
+ * static const FName Emotion(TEXT("emotion"));
+ * static const FName Priority(TEXT("priority"));
+ * TArray<FNodeRef> Barks;
+ * Database->QueryNodes(FGSPropertyQuery().Equals(Emotion, TEXT("angry")).GreaterThan(Priority, 3), Barks);
+ * \endcode
+ */
+struct GAMESCRIPT_API FGSPropertyQuery
+{
+	struct FFilter
+	{
+		FName Property;
+		bool bString = false;
+		FString String;                                   // String equality (case-sensitive)
+		double Min = TNumericLimits<double>::Lowest();    // Numeric bounds; equality is Min == Max
+		double Max = TNumericLimits<double>::Max();
+		bool bMinInclusive = true;
+		bool bMaxInclusive = true;
+	};
+
+	TArray<FFilter> Filters;
+
+	FGSPropertyQuery& Equals(FName Property, const FString& Value);
+	FGSPropertyQuery& Equals(FName Property, const TCHAR* Value) { return Equals(Property, FString(Value)); }
+	FGSPropertyQuery& Equals(FName Property, int32 Value) { return AddRange(Property, Value, true, Value, true); }
+	FGSPropertyQuery& Equals(FName Property, double Value) { return AddRange(Property, Value, true, Value, true); }
+	FGSPropertyQuery& Equals(FName Property, bool Value) { return AddRange(Property, Value ? 1.0 : 0.0, true, Value ? 1.0 : 0.0, true); }
+
+	/** Min <= value <= Max */
+	FGSPropertyQuery& Between(FName Property, double Min, double Max) { return AddRange(Property, Min, true, Max, true); }
+
+	FGSPropertyQuery& GreaterThan(FName Property, double Value) { return AddRange(Property, Value, false, TNumericLimits<double>::Max(), true); }
+	FGSPropertyQuery& AtLeast(FName Property, double Value) { return AddRange(Property, Value, true, TNumericLimits<double>::Max(), true); }
+	FGSPropertyQuery& LessThan(FName Property, double Value) { return AddRange(Property, TNumericLimits<double>::Lowest(), true, Value, false); }
+	FGSPropertyQuery& AtMost(FName Property, double Value) { return AddRange(Property, TNumericLimits<double>::Lowest(), true, Value, true); }
+
+private:
+	FGSPropertyQuery& AddRange(FName Property, double Min, bool bMinInclusive, double Max, bool bMaxInclusive);
+};
@@ -116,6 +116,13 @@ struct GAMESCRIPT_API FConversationRef
 	int32 GetPropertyCount() const;
 	FConversationPropertyRef GetProperty(int32 PropertyIndex) const;
 
+	// Property access by template name (binary search; keep names in static FNames)
+	FConversationPropertyRef FindProperty(FName Name) const;
+	bool TryGetString(FName Name, FString& OutValue) const;
+	bool TryGetInt(FName Name, int32& OutValue) const;
+	bool TryGetFloat(FName Name, float& OutValue) const;
+	bool TryGetBool(FName Name, bool& OutValue) const;
+
 	const UGameScriptDatabase* Database;
 	int32 Index;
 };
@@ -152,6 +159,13 @@ struct GAMESCRIPT_API FNodeRef
 	int32 GetPropertyCount() const;
 	FNodePropertyRef GetProperty(int32 PropertyIndex) const;
 
+	// Property access by template name (binary search; keep names in static FNames)
+	FNodePropertyRef FindProperty(FName Name) const;
+	bool TryGetString(FName Name, FString& OutValue) const;
+	bool TryGetInt(FName Name, int32& OutValue) const;
+	bool TryGetFloat(FName Name, float& OutValue) const;
+	bool TryGetBool(FName Name, bool& OutValue) const;
+
 	/**
 	 * Resolves gender from the snapshot without a dynamic-actor provider.
 	 * Dynamic grammatical gender falls back to GenderCategory::Other.
@@ -285,6 +299,7 @@ struct GAMESCRIPT_API FChoiceRef
 
 	int32 GetPropertyCount() const;
 	FNodePropertyRef GetProperty(int32 PropertyIndex) const;
+	FNodePropertyRef FindProperty(FName Name) const;
 
 	/** Returns the underlying FNodeRef for this choice. */
 	FNodeRef GetNode() const;
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/RefCounting.h"
+#include "TagIndex.h"
+
+namespace GameScript
+{
+	struct Snapshot;
+	struct Localization;
+}
+
+/**
+ * Structure half of a published snapshot: the snapshot bytes and the ID-to-index maps built from them.
+ * Shared by consecutive versions that keep the structure (split-layout locale changes).
+ */
+struct GAMESCRIPT_API FGSSnapshotStructure
+{
+	TArray<uint8> Buffer;
+	const GameScript::Snapshot* Snapshot = nullptr;
+
+	// ID to index maps (for O(log N) lookup by ID)
+	TMap<int32, int32> NodeIdToIndex;
+	TMap<int32, int32> ConversationIdToIndex;
+	TMap<int32, int32> ActorIdToIndex;
+	TMap<int32, int32> LocalizationIdToIndex;
+	TMap<int32, int32> EdgeIdToIndex;
+	TMap<int32, int32> PropertyTemplateIdToIndex;
+
+	// Property lookup by name: template name -> template index, and per node/conversation its
+	// properties sorted by template index (entity i owns slots [Offsets[i], Offsets[i + 1]))
+	struct FPropertySlot
+	{
+		int32 TemplateIndex;
+		int32 PropertyIndex;
+	};
+	TMap<FName, int32> PropertyTemplateNameToIndex;
+	TArray<FPropertySlot> NodePropertySlots;
+	TArray<int32> NodePropertyOffsets;
+	TArray<FPropertySlot> ConversationPropertySlots;
+	TArray<int32> ConversationPropertyOffsets;
+
+	// Tag bitmaps (conversation_tag_* / localization_tag_* with each entity's tag_indices)
+	FGSTagIndex ConversationTags;
+	FGSTagIndex LocalizationTags;
+
+	/**
+	 * Take ownership of a snapshot buffer and build the ID maps, property and tag indices.
+	 * The buffer must be fully verified, or at least pass VerifyIndexedFields.
+	 */
+	explicit FGSSnapshotStructure(TArray<uint8>&& InBuffer);
+	FGSSnapshotStructure() = default;
+
+	/**
+	 * Bounds-check only what the constructor reads: entity IDs, property template names and
+	 * indices, tag names, values and indices. Far cheaper than full verification (text is not
+	 * walked), so a buffer whose full verification is deferred can still be indexed safely.
+	 */
+	static bool VerifyIndexedFields(TConstArrayView<uint8> InBuffer);
+
+	/** Position of a named property within a node's properties. @return INDEX_NONE if absent */
+	int32 FindNodeProperty(int32 NodeIndex, FName Name) const { return FindProperty(NodePropertySlots, NodePropertyOffsets, NodeIndex, Name); }
+
+	/** Position of a named property within a conversation's properties. @return INDEX_NONE if absent */
+	int32 FindConversationProperty(int32 ConversationIndex, FName Name) const { return FindProperty(ConversationPropertySlots, ConversationPropertyOffsets, ConversationIndex, Name); }
+
+private:
+	int32 FindProperty(const TArray<FPropertySlot>& Slots, const TArray<int32>& Offsets, int32 EntityIndex, FName Name) const;
+};
+
+/**
+ * One immutable, published state of a UGameScriptDatabase: structure, ID maps and the current
+ * locale's text (read-copy-update).
+ *
+ * Any thread may pin the current version with UGameScriptDatabase::PinSnapshot() - an atomic load
+ * and a refcount increment, no locks - and read it for as long as it holds the pin. Loads, locale
+ * changes and reloads build a new version and publish it atomically on the game thread; a version
+ * is freed when its last pin is released. Resident locales and streamed (chunked) text are not
+ * part of a version: streamed entries read through a version have no variants.
+ */
+class GAMESCRIPT_API FGSSnapshotVersion : public FThreadSafeRefCountedObject
+{
+public:
+	/** Increases with every publish (across databases). */
+	uint32 GetVersion() const { return Version; }
+
+	/** Structure snapshot (nodes, edges, actors, localization keys). Null if nothing was loaded. */
+	const GameScript::Snapshot* GetSnapshot() const { return Structure->Snapshot; }
+
+	/** Snapshot carrying the locale's identity and text (the string table for split layouts). */
+	const GameScript::Snapshot* GetLocaleSnapshot() const { return StringTable ? StringTable : Structure->Snapshot; }
+
+	/** Text-bearing entry for a localization index, or null if out of range. */
+	const GameScript::Localization* GetLocalizationText(int32 LocalizationIdx) const;
+
+	/** ID to index lookups. @return INDEX_NONE if not found */
+	int32 FindNodeIndex(int32 NodeId) const { return FindIndex(Structure->NodeIdToIndex, NodeId); }
+	int32 FindConversationIndex(int32 ConversationId) const { return FindIndex(Structure->ConversationIdToIndex, ConversationId); }
+	int32 FindActorIndex(int32 ActorId) const { return FindIndex(Structure->ActorIdToIndex, ActorId); }
+	int32 FindLocalizationIndex(int32 LocalizationId) const { return FindIndex(Structure->LocalizationIdToIndex, LocalizationId); }
+	int32 FindEdgeIndex(int32 EdgeId) const { return FindIndex(Structure->EdgeIdToIndex, EdgeId); }
+	int32 FindPropertyTemplateIndex(int32 TemplateId) const { return FindIndex(Structure->PropertyTemplateIdToIndex, TemplateId); }
+
+	/** Named property lookups (binary search, no string conversion). @return INDEX_NONE if absent */
+	int32 FindNodeProperty(int32 NodeIndex, FName Name) const { return Structure->FindNodeProperty(NodeIndex, Name); }
+	int32 FindConversationProperty(int32 ConversationIndex, FName Name) const { return Structure->FindConversationProperty(ConversationIndex, Name); }
+
+	/** Tag bitmaps. */
+	const FGSTagIndex& GetConversationTags() const { return Structure->ConversationTags; }
+	const FGSTagIndex& GetLocalizationTags() const { return Structure->LocalizationTags; }
+
+private:
+	friend class UGameScriptDatabase;
+
+	uint32 Version = 0;
+	TSharedRef<const FGSSnapshotStructure, ESPMode::ThreadSafe> Structure;
+	TArray<uint8> StringTableBuffer;
+	const GameScript::Snapshot* StringTable = nullptr;
+
+	FGSSnapshotVersion(TSharedRef<const FGSSnapshotStructure, ESPMode::ThreadSafe> InStructure, TArray<uint8>&& InStringTableBuffer);
+
+	static int32 FindIndex(const TMap<int32, int32>& Map, int32 Id)
+	{
+		const int32* Index = Map.Find(Id);
+		return Index ? *Index : INDEX_NONE;
+	}
+};
+
+/** A reader's reference to a published version (null if the database has nothing loaded). */
+typedef TRefCountPtr<const FGSSnapshotVersion> FGSSnapshotPin;
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Tag filter over conversations or localizations: every category term must match (AND),
+ * any listed value within a term may match (OR). Category and value names are the editor's
+ * tag names and match case-sensitively, as on every runtime. An unknown category or a term
+ * with no known value matches nothing; an empty query matches everything.
+ *
+ * \code
+ * TArray<FConversationRef> Barks;
+ * Database->QueryConversations(FGSTagQuery().Where(TEXT("region"), TEXT("Docks")).Where(TEXT("type"), TEXT("Bark")), Barks);
+ * \endcode
+ */
+struct GAMESCRIPT_API FGSTagQuery
+{
+	struct FTerm
+	{
+		FString Category;
+		TArray<FString> Values;
+	};
+
+	TArray<FTerm> Terms;
+
+	FGSTagQuery& Where(const FString& Category, const FString& Value);
+	FGSTagQuery& WhereAny(const FString& Category, TArray<FString> Values);
+};
+
+/**
+ * Per-tag-value bitmaps over one entity table (conversations or localizations), built at load.
+ *
+ * Each tag value keeps its entities in a roaring-style container: a sorted index array while
+ * sparse, a dense 64-bit word bitmap once that is smaller. A query ORs a term's values into a
+ * scratch bitmap and ANDs the terms word by word (straight loops the compiler vectorizes), then
+ * extracts the set bits. Immutable after Finalize(); safe to query from any thread.
+ */
+class GAMESCRIPT_API FGSTagIndex
+{
+public:
+	// --- Building ---
+
+	/** Add a category with its values (in snapshot order). @return Category index */
+	int32 AddCategory(const FString& Name, const TArray<FString>& Values);
+
+	/** Tag an entity with a category's value (indices as in tag_indices). */
+	void Add(int32 Category, int32 Value, int32 EntityIndex);
+
+	/** Choose each value's container. Call once, after every Add(). */
+	void Finalize(int32 InEntityCount);
+
+	// --- Queries ---
+
+	/** Collect the entities matching a query. @param OutIndices - Ascending entity indices (replaced) */
+	void Query(const FGSTagQuery& Query, TArray<int32>& OutIndices) const;
+
+	/** Number of entities tagged with a category's value (0 if unknown). */
+	int32 CountTagged(const FString& Category, const FString& Value) const;
+
+	bool IsEmpty() const { return Categories.Num() == 0; }
+
+private:
+	struct FContainer
+	{
+		TArray<int32> Indices;   // Sparse: ascending entity indices (built by Add)
+		TArray<uint64> Words;    // Dense: one bit per entity (Indices emptied)
+		int32 Count = 0;
+	};
+
+	/** Exact name lookup (TMap's default FString key funcs ignore case). */
+	struct FCaseSensitiveKeyFuncs : BaseKeyFuncs<TPair<FString, int32>, FString, false>
+	{
+		static const FString& GetSetKey(const TPair<FString, int32>& Element) { return Element.Key; }
+		static bool Matches(const FString& A, const FString& B) { return A.Equals(B, ESearchCase::CaseSensitive); }
+		static uint32 GetKeyHash(const FString& Key) { return FCrc::StrCrc32(*Key); }
+	};
+
+	using FNameMap = TMap<FString, int32, FDefaultSetAllocator, FCaseSensitiveKeyFuncs>;
+
+	struct FCategory
+	{
+		FString Name;
+		FNameMap ValueToIndex;
+		TArray<FContainer> Values;
+	};
+
+	TArray<FCategory> Categories;
+	FNameMap CategoryToIndex;
+	int32 EntityCount = 0;
+	int32 WordCount = 0;
+
+	const FContainer* FindContainer(const FCategory& Category, const FString& Value) const;
+	static void OrInto(TArray<uint64>& Words, const FContainer& Container);
+};
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Refs.h"
+#include "TextResolutionParams.h"
+#include "SnapshotVersion.h"
+#include "Internationalization/Culture.h"
+
+namespace GameScript { struct Snapshot; struct Localization; }
+
+/**
+ * Per-locale formatting state: culture info and CLDR rule indices
+ * (looked up once per locale to avoid per-call locale normalization).
+ */
+struct GAMESCRIPT_API FGSLocaleFormat
+{
+	FString LocaleName;
+	FCulturePtr Culture;
+	uint8 CardinalRuleIdx = 0;
+	uint8 OrdinalRuleIdx = 0;
+
+	/**
+	 * Look up culture and plural rules for a locale code (underscore or hyphen form).
+	 * Falls back to the default culture when the code is empty or unknown. Game thread.
+	 */
+	static FGSLocaleFormat Make(const FString& LocaleName);
+};
+
+/**
+ * Re-entrant text resolution for worker threads (loading threads, subtitle jobs, localization QA).
+ *
+ * Created on the game thread by UGameScriptDatabase::CreateTextResolver(), which captures the
+ * loaded text and builds the formatting state of every resident locale up front. The resolver is
+ * immutable afterwards: ResolveText() may be called concurrently from any number of threads,
+ * each using its own (thread-local or caller-supplied) scratch buffer.
+ *
+ * It reads snapshot memory in place and pins what it reads (the snapshot version, resident
+ * locale buffers and streamed blocks), so it outlives locale changes, reloads and evictions - it
+ * keeps resolving the text it was created with. Streamed (chunked) text is available only for
+ * conversations resident at creation.
+ *
+ * UGameScriptRunner::ResolveText() uses the same static building blocks on the game thread.
+ */
+class GAMESCRIPT_API FGSTextResolver
+{
+public:
+	/**
+	 * Resolve a localization entry (gender, plural, variant, template), walking the locale's
+	 * manifest fallback chain when the translation is missing. Uses a thread-local scratch buffer.
+	 * @param Locale - Locale to resolve in; invalid ref means the current locale at creation
+	 * @return The resolved string, or empty if no resident locale in the chain has text
+	 */
+	FString ResolveText(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale = FLocaleRef()) const;
+
+	/** Same as above with a caller-supplied scratch buffer for template substitution. */
+	FString ResolveText(int32 LocalizationIdx, const FTextResolutionParams& Parms, FLocaleRef Locale, FString& Scratch) const;
+
+	/** Whether a locale's text was resident when the resolver was created. */
+	bool HasLocale(FLocaleRef Locale) const { return FindLocale(Locale.IsValid() ? Locale.Index : CurrentLocaleIndex) != nullptr; }
+
+	// --- Building Blocks ---
+	// Pure functions of their arguments (any thread).
+
+	/** Resolve one localization's text with a locale's formatting state. */
+	static FString ResolveLocalization(const GameScript::Localization* Loc, const GameScript::Snapshot* Structure,
+		const FTextResolutionParams& Parms, const FGSLocaleFormat& Format, FString& Scratch);
+
+	/** Caller override, else the subject actor's grammatical gender, else the entry's subject gender. */
+	static EGSGenderCategory ResolveGender(const GameScript::Localization* Loc, const FTextResolutionParams& Parms,
+		const GameScript::Snapshot* Structure);
+
+	/** Substitute {name} placeholders from Parms into OutText ({{ and }} are escapes). */
+	static void ApplyTemplate(const FString& Text, const FTextResolutionParams& Parms, const FGSLocaleFormat& Format, FString& OutText);
+
+	/** Format one typed argument for a locale. */
+	static void FormatArg(const FGSArg& Arg, const FGSLocaleFormat& Format, FString& OutResult);
+
+private:
+	friend class UGameScriptDatabase;
+
+	struct FLocaleText
+	{
+		int32 LocaleIndex = INDEX_NONE;
+		const GameScript::Snapshot* Text = nullptr;               // String table or full snapshot
+		TArray<const GameScript::Localization*> Streamed;         // Chunked current locale: text by index (null = not resident)
+		FGSLocaleFormat Format;
+		TArray<int32> FallbackChain;
+	};
+
+	FGSSnapshotPin Version;
+	TArray<TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>> ResidentBuffers;   // Resident locales and streamed blocks
+	const GameScript::Snapshot* Structure = nullptr;
+	int32 CurrentLocaleIndex = INDEX_NONE;
+	TArray<FLocaleText> Locales;   // Current locale first
+
+	const FLocaleText* FindLocale(int32 LocaleIndex) const;
+	const GameScript::Localization* GetLocalization(const FLocaleText& Locale, int32 LocalizationIdx) const;
+
+	// Power of 10 for decimal formatting
+	static double Pow10(int32 Exponent);
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FGSSnapshotVersion;
+
+/** One search hit: a localization index and how well it matched. */
+struct GAMESCRIPT_API FGSTextMatch
+{
+	int32 LocalizationIndex = INDEX_NONE;
+
+	/** Fraction of the query's trigrams the entry contains (1 = every one). */
+	float Score = 0.f;
+};
+
+/**
+ * Trigram inverted index over one locale's text (every variant of every localization).
+ *
+ * Text is folded before indexing and querying: lower-cased, Latin diacritics stripped (precomposed
+ * and combining), punctuation treated as word breaks. Each word contributes its trigrams padded
+ * with word boundaries, so query words match as word prefixes ("drag" finds "Dragon's").
+ * A search looks up the query's trigrams (binary search over a sorted table), walks their posting
+ * lists and ranks entries by the fraction of query trigrams they contain, then by length
+ * (shorter first). Scripts written without spaces index each run as one word.
+ *
+ * Built on a worker thread from a pinned version (UGameScriptDatabase::BuildTextSearchIndex()).
+ * Immutable afterwards; safe to search from any thread.
+ */
+class GAMESCRIPT_API FGSTextSearchIndex
+{
+public:
+	/** Index a version's current-locale text. Any thread. Streamed (chunked) text is not indexed. */
+	explicit FGSTextSearchIndex(const FGSSnapshotVersion& Version);
+
+	/**
+	 * Find the localizations matching a query, best first.
+	 * @param MinScore - Fraction of query trigrams an entry must contain (1 = all, i.e. every query
+	 *                   word occurs as a word prefix; lower values tolerate typos)
+	 * @param OutMatches - Matches (replaced), at most MaxResults
+	 */
+	void Search(const FString& Query, TArray<FGSTextMatch>& OutMatches, int32 MaxResults = 50, float MinScore = 1.f) const;
+
+	/** Snapshot version whose text this indexes (FGSSnapshotVersion::GetVersion()). */
+	uint32 GetVersion() const { return Version; }
+
+	/** Number of localizations covered. */
+	int32 Num() const { return EntryTrigramCounts.Num(); }
+
+private:
+	uint32 Version = 0;
+	TArray<uint64> Trigrams;          // Distinct folded trigrams, ascending
+	TArray<int32> PostingOffsets;     // Trigram i owns Postings[PostingOffsets[i], PostingOffsets[i + 1])
+	TArray<int32> Postings;           // Localization indices, ascending per trigram
+	TArray<int32> EntryTrigramCounts; // Distinct trigrams per localization (ranks shorter entries first)
+
+	/**
+	 * Fold UTF-8 text and append its trigrams (unsorted, may repeat).
+	 * @param bWordEnds - Include end-of-word trigrams (indexing); queries omit them to match prefixes
+	 */
+	static void ExtractTrigrams(const ANSICHAR* Utf8, int32 Length, bool bWordEnds, TArray<uint64>& OutTrigrams);
+};
@@ -21,7 +21,8 @@ public class GameScriptEditor : ModuleRules
 			"LevelEditor",     // For menu integration
 			"JsonUtilities",   // For JSON serialization
 			"InputCore",       // For EKeys constants
-			"SourceCodeAccess" // For IDE launching
+			"SourceCodeAccess", // For IDE launching
+			"DirectoryWatcher"  // For snapshot hot-reload
 		});
 	}
 }
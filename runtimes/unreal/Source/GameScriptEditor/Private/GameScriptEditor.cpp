@@ -6,6 +6,9 @@
 #include "GameScriptDatabase.h"
 #include "ToolMenus.h"
 #include "LevelEditor.h"
+#include "DirectoryWatcherModule.h"
+#include "IDirectoryWatcher.h"
+#include "Misc/Paths.h"
 
 // Property customizations
 #include "PropertyDrawers/ConversationIdCustomization.h"
@@ -70,6 +73,83 @@ void FGameScriptEditorModule::StartupModule()
 
 	// Register menu extension after ToolMenus is ready
 	UToolMenus::RegisterStartupCallback(FSimpleMulticastDelegate::FDelegate::CreateRaw(this, &FGameScriptEditorModule::RegisterMenus));
+
+	// Hot-reload the editor snapshot on re-export (instead of polling from property drawers)
+	StartWatchingData();
+	SettingsChangedHandle = GetMutableDefault<UGameScriptSettings>()->OnSettingChanged().AddRaw(this, &FGameScriptEditorModule::OnSettingsChanged);
+}
+
+void FGameScriptEditorModule::StartWatchingData()
+{
+	const UGameScriptSettings* Settings = GetDefault<UGameScriptSettings>();
+	if (!Settings || Settings->DataPath.Path.IsEmpty())
+	{
+		return;
+	}
+
+	// DataPath is relative to Content directory; the watcher needs an existing absolute directory
+	const FString DataPath = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectContentDir(), Settings->DataPath.Path));
+	if (!FPaths::DirectoryExists(DataPath))
+	{
+		UE_LOG(LogTemp, Log, TEXT("GameScript: %s does not exist yet - snapshot changes are not watched until DataPath is set again"), *DataPath);
+		return;
+	}
+
+	FDirectoryWatcherModule& DirectoryWatcherModule = FModuleManager::LoadModuleChecked<FDirectoryWatcherModule>(TEXT("DirectoryWatcher"));
+	IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule.Get();
+	if (DirectoryWatcher && DirectoryWatcher->RegisterDirectoryChangedCallback_Handle(
+		DataPath,
+		IDirectoryWatcher::FDirectoryChanged::CreateRaw(this, &FGameScriptEditorModule::OnDataDirectoryChanged),
+		DataWatcherHandle))
+	{
+		WatchedDataPath = DataPath;
+	}
+}
+
+void FGameScriptEditorModule::StopWatchingData()
+{
+	if (WatchedDataPath.IsEmpty())
+	{
+		return;
+	}
+
+	if (FDirectoryWatcherModule* DirectoryWatcherModule = FModuleManager::GetModulePtr<FDirectoryWatcherModule>(TEXT("DirectoryWatcher")))
+	{
+		if (IDirectoryWatcher* DirectoryWatcher = DirectoryWatcherModule->Get())
+		{
+			DirectoryWatcher->UnregisterDirectoryChangedCallback_Handle(WatchedDataPath, DataWatcherHandle);
+		}
+	}
+	WatchedDataPath.Empty();
+	DataWatcherHandle.Reset();
+}
+
+void FGameScriptEditorModule::OnDataDirectoryChanged(const TArray<FFileChangeData>& Changes)
+{
+	// Only exports matter: the manifest and snapshot files (.gsb, .gsz, .gsc, .gss, .gst)
+	for (const FFileChangeData& Change : Changes)
+	{
+		const FString Extension = FPaths::GetExtension(Change.Filename);
+		if (FPaths::GetCleanFilename(Change.Filename) == TEXT("manifest.json") || Extension.StartsWith(TEXT("gs")))
+		{
+			UGameScriptDatabase::EditorRequestReload();
+			return;
+		}
+	}
+}
+
+void FGameScriptEditorModule::OnSettingsChanged(UObject* Settings, FPropertyChangedEvent& PropertyChangedEvent)
+{
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName != GET_MEMBER_NAME_CHECKED(UGameScriptSettings, DataPath)
+		&& PropertyName != GET_MEMBER_NAME_CHECKED(UGameScriptSettings, EditorLocaleIndex))
+	{
+		return;
+	}
+
+	StopWatchingData();
+	StartWatchingData();
+	UGameScriptDatabase::EditorRequestReload();
 }
 
 void FGameScriptEditorModule::RegisterMenus()
@@ -88,6 +168,30 @@ void FGameScriptEditorModule::RegisterMenus()
 			FSlateIcon(),
 			FUIAction(FExecuteAction::CreateStatic(&SGameScriptTestRig::OpenWindow))
 		);
+
+		Section.AddMenuEntry(
+			"PackStreamingSnapshots",
+			LOCTEXT("PackStreamingSnapshots", "Pack Streaming Snapshots"),
+			LOCTEXT("PackStreamingSnapshotsTooltip", "Pack each exported locale snapshot into a chunked .gsc for on-demand conversation streaming"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([]() { UGameScriptDatabase::EditorPackChunkedSnapshots(); }))
+		);
+
+		Section.AddMenuEntry(
+			"CompressSnapshots",
+			LOCTEXT("CompressSnapshots", "Compress Snapshots"),
+			LOCTEXT("CompressSnapshotsTooltip", "Compress each exported locale snapshot into a block-compressed .gsz"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([]() { UGameScriptDatabase::EditorCompressSnapshots(); }))
+		);
+
+		Section.AddMenuEntry(
+			"SplitLocaleSnapshots",
+			LOCTEXT("SplitLocaleSnapshots", "Split Locale Snapshots"),
+			LOCTEXT("SplitLocaleSnapshotsTooltip", "Split the exported locale snapshots into one shared structure.gss and a small .gst string table per locale"),
+			FSlateIcon(),
+			FUIAction(FExecuteAction::CreateLambda([]() { UGameScriptDatabase::EditorSplitSnapshots(); }))
+		);
 	}
 }
 
@@ -100,6 +204,13 @@ void FGameScriptEditorModule::ShutdownModule()
 	// Close test rig window if open
 	SGameScriptTestRig::CloseWindow();
 
+	// Stop watching exported data
+	if (UObjectInitialized() && !IsEngineExitRequested())
+	{
+		GetMutableDefault<UGameScriptSettings>()->OnSettingChanged().Remove(SettingsChangedHandle);
+	}
+	StopWatchingData();
+
 	// Unregister PIE validation
 	FGameScriptBuildValidation::UnregisterPIEValidation();
 
@@ -0,0 +1,144 @@
+#include "PickerSearchIndex.h"
+#include "SBasePickerWindow.h"
+#include "GameScriptDatabase.h"
+#include "Async/Async.h"
+
+TSharedRef<const FPickerSearchIndex> FPickerSearchIndex::Get(FName Kind, TFunctionRef<void(TArray<FPickerItem>&)> Load)
+{
+	struct FCacheEntry
+	{
+		uint32 Version = 0;
+		TSharedPtr<const FPickerSearchIndex> Index;
+	};
+	static TMap<FName, FCacheEntry> Cache;
+
+	check(IsInGameThread());
+
+	// A hot reload (EditorRequestReload) publishes a new snapshot version, which invalidates every kind
+	auto CurrentVersion = []()
+	{
+		const FGSSnapshotPin Pin = UGameScriptDatabase::EditorInstance ? UGameScriptDatabase::EditorInstance->PinSnapshot() : FGSSnapshotPin();
+		return Pin ? Pin->GetVersion() : 0u;
+	};
+	uint32 Version = CurrentVersion();
+
+	FCacheEntry& Entry = Cache.FindOrAdd(Kind);
+	if (!Entry.Index.IsValid() || Entry.Version != Version || Version == 0)
+	{
+		TArray<FPickerItem> Loaded;
+		Load(Loaded);
+
+		// The first Load creates the editor database, so the version is only known afterwards
+		Version = CurrentVersion();
+
+		TSharedRef<FPickerSearchIndex> Index = MakeShared<FPickerSearchIndex>();
+		TSharedRef<TArray<FString>, ESPMode::ThreadSafe> LowerNames = MakeShared<TArray<FString>, ESPMode::ThreadSafe>();
+		Index->Items.Reserve(Loaded.Num());
+		LowerNames->Reserve(Loaded.Num());
+		for (FPickerItem& Item : Loaded)
+		{
+			LowerNames->Add(Item.Name.ToLower());
+			Index->Items.Add(MakeShared<FPickerItem>(MoveTemp(Item)));
+		}
+		Index->LowerNames = LowerNames;
+
+		Entry.Version = Version;
+		Entry.Index = Index;
+	}
+	return Entry.Index.ToSharedRef();
+}
+
+int32 FPickerSearchIndex::Score(const FString& LowerName, const FString& LowerQuery)
+{
+	if (LowerQuery.IsEmpty())
+	{
+		return 0;
+	}
+
+	auto IsWordStart = [&LowerName](int32 Index)
+	{
+		return Index == 0 || !FChar::IsAlnum(LowerName[Index - 1]);
+	};
+
+	// Substring: earlier, word-aligned matches covering more of the name first
+	const int32 Found = LowerName.Find(LowerQuery, ESearchCase::CaseSensitive);
+	if (Found != INDEX_NONE)
+	{
+		return 2000 + (IsWordStart(Found) ? 200 : 0)
+			- FMath::Min(Found, 100)
+			- FMath::Min(LowerName.Len() - LowerQuery.Len(), 100);
+	}
+
+	// Subsequence: reward runs and word starts, penalize a late first match
+	int32 Score = 0;
+	int32 QueryIndex = 0;
+	int32 Previous = INDEX_NONE;
+	int32 First = INDEX_NONE;
+	for (int32 i = 0; i < LowerName.Len() && QueryIndex < LowerQuery.Len(); ++i)
+	{
+		if (LowerName[i] != LowerQuery[QueryIndex])
+		{
+			continue;
+		}
+
+		Score += 1;
+		if (Previous != INDEX_NONE && i == Previous + 1)
+		{
+			Score += 5;
+		}
+		if (IsWordStart(i))
+		{
+			Score += 8;
+		}
+		if (First == INDEX_NONE)
+		{
+			First = i;
+		}
+		Previous = i;
+		++QueryIndex;
+	}
+
+	if (QueryIndex < LowerQuery.Len())
+	{
+		return INDEX_NONE;
+	}
+	return FMath::Clamp(Score - FMath::Min(First, 20), 0, 1999);
+}
+
+void FPickerSearch::Launch(const TSharedRef<FPickerSearch, ESPMode::ThreadSafe>& Search)
+{
+	Async(EAsyncExecution::ThreadPool, [Search]()
+	{
+		// Batches keep the lock short and let the picker show matches while the rest are scored
+		constexpr int32 BatchSize = 4096;
+		const TArray<FString>& Names = *Search->LowerNames;
+		TArray<FPickerMatch> Batch;
+		for (int32 Begin = 0; Begin < Names.Num() && !Search->bCancelled; Begin += BatchSize)
+		{
+			const int32 End = FMath::Min(Begin + BatchSize, Names.Num());
+			for (int32 i = Begin; i < End; ++i)
+			{
+				const int32 Score = FPickerSearchIndex::Score(Names[i], Search->LowerQuery);
+				if (Score != INDEX_NONE)
+				{
+					Batch.Add(FPickerMatch{ i, Score });
+				}
+			}
+
+			if (Batch.Num() > 0)
+			{
+				FScopeLock Lock(&Search->PendingLock);
+				Search->Pending.Append(Batch);
+			}
+			Batch.Reset();
+		}
+		Search->bDone = true;
+	});
+}
+
+void FPickerSearch::Drain(TArray<FPickerMatch>& OutMatches)
+{
+	FScopeLock Lock(&PendingLock);
+	OutMatches.Append(Pending);
+	Pending.Reset();
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+struct FPickerItem;
+
+/** One fuzzy match: an item position in FPickerSearchIndex::Items and its score (higher is better). */
+struct FPickerMatch
+{
+	int32 ItemIndex = INDEX_NONE;
+	int32 Score = 0;
+};
+
+/**
+ * Pre-lowercased item names for a picker kind, shared by every picker window of that kind.
+ *
+ * Built once per snapshot version: Get() reloads only after the editor snapshot is hot-reloaded.
+ * The index and its Items are game-thread only. LowerNames is immutable and shared on its own with
+ * background searches, so a worker never holds (or releases) an item pointer.
+ */
+class FPickerSearchIndex
+{
+public:
+	TArray<TSharedPtr<FPickerItem>> Items;
+	TSharedRef<const TArray<FString>, ESPMode::ThreadSafe> LowerNames = MakeShared<TArray<FString>, ESPMode::ThreadSafe>();
+
+	/**
+	 * Get the cached index for a picker kind, loading it when missing or stale. Game thread.
+	 * @param Load - Fills the items from the editor database
+	 */
+	static TSharedRef<const FPickerSearchIndex> Get(FName Kind, TFunctionRef<void(TArray<FPickerItem>&)> Load);
+
+	/**
+	 * Fuzzy-score a lowercased name against a lowercased query: every query character must appear
+	 * in order. Contiguous runs, word starts and an early first match score higher; a substring
+	 * match scores above any scattered one.
+	 * @return Score, or INDEX_NONE if the query is not a subsequence of the name
+	 */
+	static int32 Score(const FString& LowerName, const FString& LowerQuery);
+};
+
+/**
+ * One background search over an index's LowerNames. The task appends matches in item order in
+ * batches; the picker drains them on the game thread until the task is done, then ranks the full result.
+ */
+struct FPickerSearch
+{
+	TSharedRef<const TArray<FString>, ESPMode::ThreadSafe> LowerNames;
+	FString LowerQuery;
+
+	std::atomic<bool> bCancelled{ false };
+	std::atomic<bool> bDone{ false };
+
+	FCriticalSection PendingLock;
+	TArray<FPickerMatch> Pending;
+
+	FPickerSearch(TSharedRef<const TArray<FString>, ESPMode::ThreadSafe> InLowerNames, FString InLowerQuery)
+		: LowerNames(MoveTemp(InLowerNames)), LowerQuery(MoveTemp(InLowerQuery))
+	{
+	}
+
+	/** Start scoring on a worker thread. */
+	static void Launch(const TSharedRef<FPickerSearch, ESPMode::ThreadSafe>& Search);
+
+	/** Move the matches found so far into OutMatches (appended). Game thread. */
+	void Drain(TArray<FPickerMatch>& OutMatches);
+};
@@ -28,5 +28,10 @@ protected:
 		return FText::FromString(TEXT("Select Actor"));
 	}
 
+	virtual FName GetItemKind() const override
+	{
+		return FName(TEXT("Actor"));
+	}
+
 	virtual void LoadItems(TArray<FPickerItem>& OutItems) override;
 };
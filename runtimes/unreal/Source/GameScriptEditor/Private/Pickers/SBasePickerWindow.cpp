@@ -14,25 +14,17 @@ void SBasePickerWindow::Construct(const FArguments& InArgs)
 	OnSelectionChanged = InArgs._OnSelectionChanged;
 	SelectedId = CurrentValue;
 
-	// Load items from derived class
-	TArray<FPickerItem> LoadedItems;
-	LoadItems(LoadedItems);
+	// Cached items (loaded from derived class on first use or after hot reload)
+	SearchIndex = FPickerSearchIndex::Get(GetItemKind(), [this](TArray<FPickerItem>& OutItems) { LoadItems(OutItems); });
 
-	// Add "None" option if enabled
-	AllItems.Empty();
+	// "None" option (shown while the search is empty) if enabled
 	if (IncludeNoneOption())
 	{
-		AllItems.Add(MakeShared<FPickerItem>(0, TEXT("(None)"), FString()));
-	}
-
-	// Add loaded items
-	for (const FPickerItem& Item : LoadedItems)
-	{
-		AllItems.Add(MakeShared<FPickerItem>(Item));
+		NoneItem = MakeShared<FPickerItem>(0, TEXT("(None)"), FString());
 	}
 
 	// Initialize filtered items
-	FilteredItems = AllItems;
+	FilterItems();
 
 	// Create list view
 	ListView = SNew(SListView<TSharedPtr<FPickerItem>>)
@@ -150,16 +142,6 @@ TSharedRef<ITableRow> SBasePickerWindow::MakeListRowWidget(TSharedPtr<FPickerIte
 		];
 }
 
-bool SBasePickerWindow::MatchesFilter(const FPickerItem& Item, const FString& InSearchText) const
-{
-	if (InSearchText.IsEmpty())
-	{
-		return true;
-	}
-
-	return Item.Name.Contains(InSearchText);
-}
-
 void SBasePickerWindow::OnItemSelected(TSharedPtr<FPickerItem> Item, ESelectInfo::Type SelectInfo)
 {
 	if (Item.IsValid())
@@ -185,13 +167,47 @@ void SBasePickerWindow::OnSearchTextChanged(const FText& InSearchText)
 
 void SBasePickerWindow::FilterItems()
 {
-	FilteredItems.Empty();
+	CancelSearch();
+	FilteredItems.Reset();
+	Matches.Reset();
 
-	for (const TSharedPtr<FPickerItem>& Item : AllItems)
+	const FString LowerQuery = SearchText.TrimStartAndEnd().ToLower();
+	if (LowerQuery.IsEmpty())
+	{
+		if (NoneItem.IsValid())
+		{
+			FilteredItems.Add(NoneItem);
+		}
+		for (const TSharedPtr<FPickerItem>& Item : SearchIndex->Items)
+		{
+			if (MatchesFilter(*Item, SearchText))
+			{
+				FilteredItems.Add(Item);
+			}
+		}
+	}
+	else if (SearchIndex->LowerNames->Num() <= InlineSearchLimit)
 	{
-		if (MatchesFilter(*Item, SearchText))
+		const TArray<FString>& LowerNames = *SearchIndex->LowerNames;
+		for (int32 i = 0; i < LowerNames.Num(); ++i)
 		{
-			FilteredItems.Add(Item);
+			const int32 Score = FPickerSearchIndex::Score(LowerNames[i], LowerQuery);
+			if (Score != INDEX_NONE && MatchesFilter(*SearchIndex->Items[i], SearchText))
+			{
+				Matches.Add(FPickerMatch{ i, Score });
+			}
+		}
+		ShowRankedMatches();
+		return;
+	}
+	else
+	{
+		// Large lists: score on a worker, polled from an active timer until done
+		ActiveSearch = MakeShared<FPickerSearch, ESPMode::ThreadSafe>(SearchIndex->LowerNames, LowerQuery);
+		FPickerSearch::Launch(ActiveSearch.ToSharedRef());
+		if (!SearchTimer.IsValid())
+		{
+			SearchTimer = RegisterActiveTimer(0.0f, FWidgetActiveTimerDelegate::CreateSP(this, &SBasePickerWindow::UpdateSearch));
 		}
 	}
 
@@ -201,6 +217,79 @@ void SBasePickerWindow::FilterItems()
 	}
 }
 
+EActiveTimerReturnType SBasePickerWindow::UpdateSearch(double InCurrentTime, float InDeltaTime)
+{
+	if (!ActiveSearch.IsValid())
+	{
+		SearchTimer.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Read bDone first: everything appended before it was set is drained below
+	const bool bDone = ActiveSearch->bDone;
+	const int32 Shown = Matches.Num();
+	ActiveSearch->Drain(Matches);
+
+	// Worker matches are only scored; apply the post-filter here, where items may be read
+	int32 Kept = Shown;
+	for (int32 i = Shown; i < Matches.Num(); ++i)
+	{
+		if (MatchesFilter(*SearchIndex->Items[Matches[i].ItemIndex], SearchText))
+		{
+			Matches[Kept++] = Matches[i];
+		}
+	}
+	Matches.SetNum(Kept);
+
+	if (bDone)
+	{
+		ActiveSearch.Reset();
+		SearchTimer.Reset();
+		ShowRankedMatches();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Stream new matches in item order while the search runs
+	for (int32 i = Shown; i < Matches.Num(); ++i)
+	{
+		FilteredItems.Add(SearchIndex->Items[Matches[i].ItemIndex]);
+	}
+	if (Matches.Num() > Shown && ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+	return EActiveTimerReturnType::Continue;
+}
+
+void SBasePickerWindow::CancelSearch()
+{
+	// The task notices between batches; its results are dropped with the search
+	if (ActiveSearch.IsValid())
+	{
+		ActiveSearch->bCancelled = true;
+		ActiveSearch.Reset();
+	}
+}
+
+void SBasePickerWindow::ShowRankedMatches()
+{
+	Matches.Sort([](const FPickerMatch& A, const FPickerMatch& B)
+	{
+		return A.Score != B.Score ? A.Score > B.Score : A.ItemIndex < B.ItemIndex;
+	});
+
+	FilteredItems.Reset(Matches.Num());
+	for (const FPickerMatch& Match : Matches)
+	{
+		FilteredItems.Add(SearchIndex->Items[Match.ItemIndex]);
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
 FReply SBasePickerWindow::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent)
 {
 	// Enter key - select current item
@@ -225,6 +314,11 @@ FReply SBasePickerWindow::OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent
 	return SCompoundWidget::OnKeyDown(MyGeometry, InKeyEvent);
 }
 
+SBasePickerWindow::~SBasePickerWindow()
+{
+	CancelSearch();
+}
+
 void SBasePickerWindow::CloseWindow()
 {
 	if (TSharedPtr<SWindow> Window = ParentWindow.Pin())
@@ -4,6 +4,7 @@
 #include "Widgets/SCompoundWidget.h"
 #include "Widgets/Views/SListView.h"
 #include "GameScriptDatabase.h"
+#include "PickerSearchIndex.h"
 
 /**
  * Item struct for picker list views.
@@ -26,11 +27,17 @@ struct FPickerItem
  * Base class for GameScript picker windows.
  * Provides common UI structure: search field + list view + selection handling.
  *
+ * Items come from a per-kind FPickerSearchIndex shared across picker instances until hot reload.
+ * Search is a case-insensitive fuzzy match; large lists are scored on a worker thread, matches
+ * stream into the list as they are found and are ranked once the search completes.
+ *
  * Derived classes override:
  * - GetWindowTitle() - Window title text
- * - LoadItems() - Populate allItems array from database
+ * - GetItemKind() - Search index cache key
+ * - LoadItems() - Populate the items from the database (on cache miss)
  * - MakeListItemWidget() - Create widget for list item
  * - IncludeNoneOption() - Whether to show "(None)" at top
+ * - MatchesFilter() - Extra filtering over the search results
  */
 class SBasePickerWindow : public SCompoundWidget
 {
@@ -43,6 +50,8 @@ public:
 	/** Construct the widget. */
 	void Construct(const FArguments& InArgs);
 
+	virtual ~SBasePickerWindow();
+
 	/** Show the picker window as a popup. */
 	static TSharedPtr<SWindow> ShowPicker(
 		TSharedRef<SWidget> ParentWidget,
@@ -57,9 +66,17 @@ public:
 protected:
 	/** Override in derived classes. */
 	virtual FText GetWindowTitle() const = 0;
+	virtual FName GetItemKind() const = 0;
 	virtual void LoadItems(TArray<FPickerItem>& OutItems) = 0;
 	virtual bool IncludeNoneOption() const { return true; }
 
+	/**
+	 * Post-filter over the items the fuzzy search accepts (every item for an empty query). Runs on
+	 * the Slate thread, before ranking. The "(None)" item is never filtered.
+	 * @param SearchText - The search box text as typed
+	 */
+	virtual bool MatchesFilter(const FPickerItem& Item, const FString& SearchText) const { return true; }
+
 	/**
 	 * Template helper to load items from database.
 	 * Eliminates code duplication across all picker implementations.
@@ -70,7 +87,6 @@ protected:
 	template<typename TGetterFunc>
 	static void LoadItemsFromDatabase(TArray<FPickerItem>& OutItems, TGetterFunc Getter)
 	{
-		UGameScriptDatabase::CheckForHotReload();
 		TArray<int32> Ids;
 		TArray<FString> Names;
 
@@ -87,9 +103,6 @@ protected:
 	/** Create list row widget (called by list view). */
 	virtual TSharedRef<ITableRow> MakeListRowWidget(TSharedPtr<FPickerItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
 
-	/** Filter items based on search text (can be overridden for custom filtering). */
-	virtual bool MatchesFilter(const FPickerItem& Item, const FString& SearchText) const;
-
 	/** Handle selection. */
 	void OnItemSelected(TSharedPtr<FPickerItem> Item, ESelectInfo::Type SelectInfo);
 	void OnItemDoubleClicked(TSharedPtr<FPickerItem> Item);
@@ -97,18 +110,30 @@ protected:
 	/** Search handling. */
 	void OnSearchTextChanged(const FText& InSearchText);
 	void FilterItems();
+	EActiveTimerReturnType UpdateSearch(double InCurrentTime, float InDeltaTime);
+	void CancelSearch();
+	void ShowRankedMatches();
 
 	/** Keyboard navigation. */
 	virtual FReply OnKeyDown(const FGeometry& MyGeometry, const FKeyEvent& InKeyEvent) override;
 
 private:
+	/** Lists up to this size are scored inline on the Slate thread. */
+	static constexpr int32 InlineSearchLimit = 5000;
+
 	/** Data. */
-	TArray<TSharedPtr<FPickerItem>> AllItems;
+	TSharedPtr<const FPickerSearchIndex> SearchIndex;
+	TSharedPtr<FPickerItem> NoneItem;
 	TArray<TSharedPtr<FPickerItem>> FilteredItems;
 	int32 CurrentValue = 0;
 	int32 SelectedId = 0;
 	FString SearchText;
 
+	/** Background search in flight and the matches received from it. */
+	TSharedPtr<FPickerSearch, ESPMode::ThreadSafe> ActiveSearch;
+	TArray<FPickerMatch> Matches;
+	TSharedPtr<FActiveTimerHandle> SearchTimer;
+
 	/** Widgets. */
 	TSharedPtr<SListView<TSharedPtr<FPickerItem>>> ListView;
 	TWeakPtr<SWindow> ParentWindow;
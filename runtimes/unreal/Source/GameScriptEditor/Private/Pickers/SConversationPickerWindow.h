@@ -29,5 +29,10 @@ protected:
 		return FText::FromString(TEXT("Select Conversation"));
 	}
 
+	virtual FName GetItemKind() const override
+	{
+		return FName(TEXT("Conversation"));
+	}
+
 	virtual void LoadItems(TArray<FPickerItem>& OutItems) override;
 };
@@ -28,6 +28,11 @@ protected:
 		return FText::FromString(TEXT("Select Locale"));
 	}
 
+	virtual FName GetItemKind() const override
+	{
+		return FName(TEXT("Locale"));
+	}
+
 	virtual void LoadItems(TArray<FPickerItem>& OutItems) override;
 
 	virtual bool IncludeNoneOption() const override { return false; } // Locales should always have a value
@@ -28,5 +28,10 @@ protected:
 		return FText::FromString(TEXT("Select Localization"));
 	}
 
+	virtual FName GetItemKind() const override
+	{
+		return FName(TEXT("Localization"));
+	}
+
 	virtual void LoadItems(TArray<FPickerItem>& OutItems) override;
 };
@@ -15,6 +15,11 @@
 
 #define LOCTEXT_NAMESPACE "GameScriptEditor"
 
+FBaseIdCustomization::~FBaseIdCustomization()
+{
+	UGameScriptDatabase::OnEditorDataReloaded.Remove(EditorReloadedHandle);
+}
+
 void FBaseIdCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils)
 {
 	// Get the "Value" property (all ID structs have an int32 Value field)
@@ -56,8 +61,9 @@ void FBaseIdCustomization::CustomizeHeader(TSharedRef<IPropertyHandle> PropertyH
 	// Set initial button visibility
 	UpdateButtons(CurrentId);
 
-	// Listen for property changes
+	// Listen for property changes, and for hot reloads (the name may have changed)
 	ValuePropertyHandle->SetOnPropertyValueChanged(FSimpleDelegate::CreateSP(this, &FBaseIdCustomization::OnValueChanged));
+	EditorReloadedHandle = UGameScriptDatabase::OnEditorDataReloaded.AddSP(this, &FBaseIdCustomization::OnValueChanged);
 
 	// Build the UI
 	HeaderRow
@@ -140,9 +146,6 @@ void FBaseIdCustomization::UpdateNameLabel(int32 Id)
 		return;
 	}
 
-	// Ensure EditorInstance is up to date (hot-reload check)
-	UGameScriptDatabase::CheckForHotReload();
-
 	if (Id == 0)
 	{
 		NameLabel->SetText(LOCTEXT("NoneLabel", "(None)"));
@@ -18,6 +18,8 @@
 class FBaseIdCustomization : public IPropertyTypeCustomization
 {
 public:
+	virtual ~FBaseIdCustomization();
+
 	// IPropertyTypeCustomization interface
 	virtual void CustomizeHeader(TSharedRef<IPropertyHandle> PropertyHandle, FDetailWidgetRow& HeaderRow, IPropertyTypeCustomizationUtils& CustomizationUtils) override;
 	virtual void CustomizeChildren(TSharedRef<IPropertyHandle> PropertyHandle, IDetailChildrenBuilder& ChildBuilder, IPropertyTypeCustomizationUtils& CustomizationUtils) override;
@@ -60,4 +62,7 @@ private:
 	TSharedPtr<SWidget> PickerButton;
 	TSharedPtr<SWidget> ClearButton;
 	TSharedPtr<SWidget> EditButton;
+
+	// UGameScriptDatabase::OnEditorDataReloaded subscription (refreshes the name label)
+	FDelegateHandle EditorReloadedHandle;
 };
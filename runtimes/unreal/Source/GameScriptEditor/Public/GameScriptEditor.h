@@ -12,4 +12,18 @@ public:
 private:
 	/** Register menu extensions. Called after ToolMenus is ready. */
 	void RegisterMenus();
+
+	/** Watch the exported data directory (UGameScriptSettings::DataPath) for re-exports. */
+	void StartWatchingData();
+	void StopWatchingData();
+
+	/** Directory watcher callback: request one debounced editor reload for relevant changes. */
+	void OnDataDirectoryChanged(const TArray<struct FFileChangeData>& Changes);
+
+	/** Re-register the watcher when DataPath changes. */
+	void OnSettingsChanged(UObject* Settings, struct FPropertyChangedEvent& PropertyChangedEvent);
+
+	FString WatchedDataPath;
+	FDelegateHandle DataWatcherHandle;
+	FDelegateHandle SettingsChangedHandle;
 };
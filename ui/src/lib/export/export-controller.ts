@@ -147,6 +147,9 @@ export class ExportController {
       const existingHashByName = new Map(
         existingManifest?.locales.map((l) => [l.name, l.hash]) ?? []
       );
+      const existingFallbackByName = new Map(
+        existingManifest?.locales.flatMap((l) => (l.fallback ? [[l.name, l.fallback] as const] : [])) ?? []
+      );
 
       // Build manifest locales as we process
       const manifestLocales: ExportManifestLocale[] = [];
@@ -187,7 +190,8 @@ export class ExportController {
 
         // Add to manifest locales
         const localizedName = localizedNames.get(locale.id) ?? locale.name;
-        manifestLocales.push({ id: locale.id, name: locale.name, localizedName, hash });
+        const fallback = existingFallbackByName.get(locale.name);
+        manifestLocales.push({ id: locale.id, name: locale.name, localizedName, hash, ...(fallback ? { fallback } : {}) });
 
         // Check if unchanged
         if (existingHashByName.get(locale.name) === hash) {
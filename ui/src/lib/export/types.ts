@@ -231,6 +231,8 @@ export interface ExportManifestLocale {
   name: string;
   localizedName: string;
   hash: string;
+  /** Optional locale name runtimes use for missing text (hand-authored, kept across exports) */
+  fallback?: string;
 }
 
 /**